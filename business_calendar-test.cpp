@@ -0,0 +1,183 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "business_calendar.hpp"
+#include <vector>
+
+static bool naive_is_business_day( const project::date& d , const std::vector<project::date>& holidays )
+{
+    using project::date;
+
+    return d.week_day() != date::day::saturday &&
+           d.week_day() != date::day::sunday   &&
+           std::find( holidays.begin() , holidays.end() , d ) == holidays.end();
+}
+
+static std::vector<project::date> random_holidays()
+{
+    using namespace project;
+
+    std::vector<date> holidays ( 400 );
+    std::mt19937      gen      { 11 };
+    std::uniform_int_distribution<> dist { 0 , 365 * 40 };
+
+    for ( auto& d : holidays )
+        d = date { 1 , 1 , 1990 } + dist( gen );
+
+    return holidays;
+}
+
+TEST_CASE( "bool business_calendar::is_business_day( const date& )" )
+{
+    using namespace project;
+
+    std::vector<date> holidays { { 1 , 1 , 2024 } , { 25 , 12 , 2024 } , { 28 , 12 , 2024 } };
+    business_calendar cal      { date { 1 , 1 , 2024 } , date { 1 , 1 , 2025 } , holidays };
+
+    REQUIRE( cal.first() == date { 1 , 1 , 2024 } );
+    REQUIRE( cal.last() == date { 1 , 1 , 2025 } );
+    REQUIRE( !cal.is_business_day( date { 1  , 1  , 2024 } ) );
+    REQUIRE( cal.is_business_day( date { 2  , 1  , 2024 } ) );
+    REQUIRE( !cal.is_business_day( date { 6  , 1  , 2024 } ) );
+    REQUIRE( !cal.is_business_day( date { 7  , 1  , 2024 } ) );
+    REQUIRE( !cal.is_business_day( date { 25 , 12 , 2024 } ) );
+    REQUIRE( cal.business_days_between( cal.first() , cal.last() ) == 262 - 2 );
+    REQUIRE_THROWS_AS( cal.is_business_day( date { 1 , 1 , 2025 } ) , std::out_of_range );
+    REQUIRE_THROWS_AS( cal.is_business_day( date { 31 , 12 , 2023 } ) , std::out_of_range );
+
+    business_calendar gulf { date { 1 , 1 , 2024 } , date { 1 , 1 , 2025 } , {} ,
+                             1 << int( date::day::friday ) | 1 << int( date::day::saturday ) };
+
+    REQUIRE( gulf.is_business_day( date { 7 , 1 , 2024 } ) );
+    REQUIRE( !gulf.is_business_day( date { 5 , 1 , 2024 } ) );
+}
+
+TEST_CASE( "int business_calendar::business_days_between( const date& , const date& )" )
+{
+    using namespace project;
+
+    auto              holidays = random_holidays();
+    business_calendar cal      { date { 1 , 1 , 1990 } , date { 1 , 1 , 2030 } , holidays };
+    std::mt19937      gen      { 3 };
+    std::uniform_int_distribution<> dist { 0 , cal.last() - cal.first() };
+
+    bool correct { true };
+
+    for ( int i {} ; i < 2000 ; ++i )
+    {
+        date from { cal.first() + dist( gen ) };
+        date to   { cal.first() + dist( gen ) };
+        int  n    {};
+
+        for ( date d { std::min( from , to ) } ; d < std::max( from , to ) ; ++d )
+            n += naive_is_business_day( d , holidays );
+
+        correct &= cal.business_days_between( from , to ) == ( from <= to ? n : -n );
+    }
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "date business_calendar::add_business_days( const date& , int )" )
+{
+    using namespace project;
+
+    auto              holidays = random_holidays();
+    business_calendar cal      { date { 1 , 1 , 1990 } , date { 1 , 1 , 2030 } , holidays };
+    std::mt19937      gen      { 5 };
+    std::uniform_int_distribution<> day_dist  { 400 , cal.last() - cal.first() - 400 };
+    std::uniform_int_distribution<> step_dist { -250 , 250 };
+
+    bool correct { true };
+
+    for ( int i {} ; i < 2000 ; ++i )
+    {
+        date start { cal.first() + day_dist( gen ) };
+        int  n     { step_dist( gen ) };
+        date d     { start };
+
+        for ( int left { n < 0 ? -n : n } ; left > 0 ; )
+        {
+            n < 0 ? --d : ++d;
+            left -= naive_is_business_day( d , holidays );
+        }
+
+        correct &= cal.add_business_days( start , n ) == d;
+    }
+
+    REQUIRE( correct );
+    REQUIRE( cal.add_business_days( date { 5 , 1 , 2024 } , 1 ) == date { 8 , 1 , 2024 } );
+    REQUIRE( cal.add_business_days( date { 6 , 1 , 2024 } , 0 ) == date { 6 , 1 , 2024 } );
+    REQUIRE_THROWS_AS( cal.add_business_days( date { 1 , 1 , 1990 } , -5 ) , std::out_of_range );
+    REQUIRE_THROWS_AS( cal.add_business_days( date { 20 , 12 , 2029 } , 30 ) , std::out_of_range );
+    REQUIRE( cal.add_business_days( cal.last() , -1 ) == date { 31 , 12 , 2029 } );
+    REQUIRE_THROWS_AS( cal.add_business_days( cal.last() , 1 ) , std::out_of_range );
+}
+
+TEST_CASE( "void business_calendar::add_holidays( std::span<const date> )" )
+{
+    using namespace project;
+
+    business_calendar cal { date { 1 , 1 , 2024 } , date { 1 , 1 , 2025 } };
+
+    REQUIRE( cal.add_business_days( date { 24 , 12 , 2024 } , 1 ) == date { 25 , 12 , 2024 } );
+
+    std::vector<date> holidays { { 25 , 12 , 2024 } , { 26 , 12 , 2024 } , { 1 , 1 , 2030 } };
+
+    cal.add_holidays( holidays );
+
+    REQUIRE( cal.add_business_days( date { 24 , 12 , 2024 } , 1 ) == date { 27 , 12 , 2024 } );
+    REQUIRE( cal.business_days_between( cal.first() , cal.last() ) == 262 - 2 );
+}
+
+TEST_CASE( "business_calendar benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    auto              holidays = random_holidays();
+    business_calendar cal      { date { 1 , 1 , 1990 } , date { 1 , 1 , 2030 } , holidays };
+    std::vector<date> starts   ( 1024 );
+    std::mt19937      gen      { 9 };
+    std::uniform_int_distribution<> dist { 400 , 365 * 39 };
+
+    for ( auto& d : starts )
+        d = cal.first() + dist( gen );
+
+    BENCHMARK( "1024 x 60 business days, week_day() loop" )
+    {
+        int sum {};
+
+        for ( date d : starts )
+        {
+            for ( int left { 60 } ; left > 0 ; )
+            {
+                ++d;
+                left -= d.week_day() != date::day::saturday && d.week_day() != date::day::sunday;
+            }
+
+            sum += d.month_day();
+        }
+
+        return sum;
+    };
+
+    BENCHMARK( "1024 x business_calendar::add_business_days( d , 60 )" )
+    {
+        int sum {};
+
+        for ( const auto& d : starts )
+            sum += cal.add_business_days( d , 60 ).month_day();
+
+        return sum;
+    };
+
+    BENCHMARK( "1024 x business_calendar::business_days_between()" )
+    {
+        int sum {};
+
+        for ( std::size_t i { 1 } ; i < starts.size() ; ++i )
+            sum += cal.business_days_between( starts[ i - 1 ] , starts[ i ] );
+
+        return sum;
+    };
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#ifndef BUSINESS_CALENDAR_H
+#define BUSINESS_CALENDAR_H
+
+#include "date.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace project
+{
+
+// Business days over the serial range [ first , last ), kept as one bit per
+// day with a running count of set bits before every 64-bit word. Counting
+// business days between two dates is a rank difference, O( 1 ); adding n
+// business days is a select, a binary search over the word counts.
+class business_calendar
+{
+
+public:
+
+    using rep = serial_date::rep;
+
+    // Bit i set means date::day( i ) is a weekend day.
+    static constexpr std::uint8_t SATURDAY_SUNDAY = 1 << int( date::day::sunday ) | 1 << int( date::day::saturday );
+
+    // Bit i of holiday_bits, counting from bit 0 of word 0, marks first + i
+    // as a holiday; bits past the end of the span mean no holiday.
+    [[nodiscard]] static business_calendar from_holiday_bits( const date& first , const date& last , std::span<const std::uint64_t> holiday_bits , std::uint8_t weekend = SATURDAY_SUNDAY );
+
+    business_calendar( const date& first , const date& last , std::span<const date> holidays = {} , std::uint8_t weekend = SATURDAY_SUNDAY );
+
+    [[nodiscard]] date first() const;
+    [[nodiscard]] date last() const;
+    [[nodiscard]] bool contains( const date& ) const;
+
+    [[nodiscard]] bool is_business_day( const date& ) const;
+
+    // Business days in [ from , to ); negative when to is before from.
+    [[nodiscard]] int business_days_between( const date& from , const date& to ) const;
+
+    // The n-th business day after d for n > 0, before d for n < 0, and d
+    // itself for n == 0.
+    [[nodiscard]] date add_business_days( const date& d , int n ) const;
+
+    void add_holidays( std::span<const date> holidays );
+
+private:
+
+    static constexpr int WORD_BITS = 64;
+
+    [[nodiscard]] std::size_t offset( const date& ) const;
+    [[nodiscard]] int rank( std::size_t i ) const;
+    [[nodiscard]] rep select( int k ) const;
+    void clear_day( const date& );
+    void build_rank();
+
+    rep                        m_first;
+    std::size_t                m_size;
+    std::vector<std::uint64_t> m_words;
+    std::vector<int>           m_rank;
+};
+
+inline business_calendar::business_calendar( const date& first , const date& last , std::span<const date> holidays , std::uint8_t weekend )
+    :   m_first { first.serial() }
+    ,   m_size  { std::size_t( std::max( last - first , 0 ) ) }
+    ,   m_words ( m_size / WORD_BITS + 1 )
+    ,   m_rank  ( m_words.size() + 1 )
+{
+    // Weekends repeat every 7 days, so build the pattern for one week
+    // starting at m_first and repeat it.
+    std::uint64_t week {};
+
+    for ( int i {} ; i < 7 ; ++i )
+        if ( !( weekend >> ( ( m_first + i + 1 ) % 7 ) & 1 ) )
+            week |= std::uint64_t( 1 ) << i;
+
+    for ( std::size_t i {} ; i < m_size ; ++i )
+        if ( week >> ( i % 7 ) & 1 )
+            m_words[ i / WORD_BITS ] |= std::uint64_t( 1 ) << ( i % WORD_BITS );
+
+    for ( const auto& d : holidays )
+        if ( contains( d ) )
+            clear_day( d );
+
+    build_rank();
+}
+
+inline business_calendar business_calendar::from_holiday_bits( const date& first , const date& last , std::span<const std::uint64_t> holiday_bits , std::uint8_t weekend )
+{
+    business_calendar cal { first , last , {} , weekend };
+
+    for ( std::size_t w {} ; w < std::min( holiday_bits.size() , cal.m_words.size() ) ; ++w )
+        cal.m_words[ w ] &= ~holiday_bits[ w ];
+
+    cal.build_rank();
+
+    return cal;
+}
+
+inline date business_calendar::first() const
+{
+    return date::from_serial( m_first );
+}
+
+inline date business_calendar::last() const
+{
+    return date::from_serial( m_first + rep( m_size ) );
+}
+
+inline bool business_calendar::contains( const date& d ) const
+{
+    return std::size_t( std::make_unsigned_t<rep>( d.serial() - m_first ) ) < m_size;
+}
+
+inline bool business_calendar::is_business_day( const date& d ) const
+{
+    if ( !contains( d ) )
+        throw std::out_of_range { "business_calendar: date outside the calendar" };
+
+    std::size_t i { offset( d ) };
+
+    return m_words[ i / WORD_BITS ] >> ( i % WORD_BITS ) & 1;
+}
+
+inline int business_calendar::business_days_between( const date& from , const date& to ) const
+{
+    return rank( offset( to ) ) - rank( offset( from ) );
+}
+
+inline date business_calendar::add_business_days( const date& d , int n ) const
+{
+    if ( n == 0 )
+        return d;
+
+    std::size_t i    { offset( d ) };
+    int         self { int( m_words[ i / WORD_BITS ] >> ( i % WORD_BITS ) & 1 ) };
+
+    // Index among all business days of the one we are after.
+    int k { n > 0 ? rank( i ) + self + n - 1 : rank( i ) + n };
+
+    if ( k < 0 || k >= m_rank.back() )
+        throw std::out_of_range { "business_calendar: result outside the calendar" };
+
+    return date::from_serial( select( k ) );
+}
+
+inline void business_calendar::add_holidays( std::span<const date> holidays )
+{
+    for ( const auto& d : holidays )
+        if ( contains( d ) )
+            clear_day( d );
+
+    build_rank();
+}
+
+// Offset of d from the first day; last() itself is allowed as an end point.
+inline std::size_t business_calendar::offset( const date& d ) const
+{
+    std::size_t i { std::size_t( std::make_unsigned_t<rep>( d.serial() - m_first ) ) };
+
+    if ( i > m_size )
+        throw std::out_of_range { "business_calendar: date outside the calendar" };
+
+    return i;
+}
+
+// Business days in the first i days.
+inline int business_calendar::rank( std::size_t i ) const
+{
+    std::uint64_t below { ( std::uint64_t( 1 ) << ( i % WORD_BITS ) ) - 1 };
+
+    return m_rank[ i / WORD_BITS ] + std::popcount( m_words[ i / WORD_BITS ] & below );
+}
+
+// Serial day number of the k-th business day, counting from 0.
+inline business_calendar::rep business_calendar::select( int k ) const
+{
+    std::size_t   w    ( std::upper_bound( m_rank.begin() , m_rank.end() , k ) - m_rank.begin() - 1 );
+    std::uint64_t word { m_words[ w ] };
+
+    for ( int skip { k - m_rank[ w ] } ; skip > 0 ; --skip )
+        word &= word - 1;
+
+    return m_first + rep( w * WORD_BITS ) + std::countr_zero( word );
+}
+
+inline void business_calendar::clear_day( const date& d )
+{
+    std::size_t i { offset( d ) };
+
+    m_words[ i / WORD_BITS ] &= ~( std::uint64_t( 1 ) << ( i % WORD_BITS ) );
+}
+
+// m_rank[ w ] counts the business days in words [ 0 , w ), so the last
+// entry is the total. The spare word past m_size keeps rank( m_size ) in
+// bounds.
+inline void business_calendar::build_rank()
+{
+    int count {};
+
+    for ( std::size_t w {} ; w < m_words.size() ; ++w )
+    {
+        m_rank[ w ] = count;
+        count      += std::popcount( m_words[ w ] );
+    }
+
+    m_rank.back() = count;
+}
+
+}
+
+#endif
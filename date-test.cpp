@@ -1,7 +1,15 @@
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include "catch.hpp"
 #include "date.hpp"
 #include <sstream>
+#include <array>
+#include <iterator>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <set>
+#include <unordered_map>
 
 TEST_CASE( "date::is_leap( int year )" )
 {
@@ -9,6 +17,14 @@ TEST_CASE( "date::is_leap( int year )" )
     REQUIRE(  project::date::is_leap( 2000 ) );
 }
 
+TEST_CASE( "date::n_days( int month , int year )" )
+{
+    STATIC_REQUIRE( project::date::n_days( 1 , 2001 ) == 31 );
+    STATIC_REQUIRE( project::date::n_days( 4 , 2001 ) == 30 );
+    STATIC_REQUIRE( project::date::n_days( 2 , 1900 ) == 28 );
+    STATIC_REQUIRE( project::date::n_days( 2 , 2000 ) == 29 );
+}
+
 TEST_CASE( "date::date()" )
 {
     project::date d;
@@ -56,6 +72,50 @@ TEST_CASE( "date::date( std::time_t )" )
     REQUIRE( d.month_day() == 15   );
 }
 
+TEST_CASE( "date::date( std::time_t ) arithmetic" )
+{
+    using namespace project;
+
+    STATIC_REQUIRE( date { 1 , 1 , 1970 }.serial() == date::EPOCH_SERIAL );
+    STATIC_REQUIRE( date { std::time_t { 0 } } == date { 1 , 1 , 1970 } );
+
+    REQUIRE( date { std::time_t { -1 } }            == date { 31 , 12 , 1969 } );
+    REQUIRE( date { std::time_t { 1660000000 } }    == date { 8  , 8  , 2022 } );
+    REQUIRE( date { std::time_t { 951782400 } }     == date { 29 , 2  , 2000 } );
+    REQUIRE( date { std::time_t { -2208988800 } }   == date { 1  , 1  , 1900 } );
+    REQUIRE( date { std::time_t { 253402300799 } }  == date { 31 , 12 , 9999 } );
+}
+
+TEST_CASE( "std::time_t date::to_time_t() const" )
+{
+    using namespace project;
+
+    STATIC_REQUIRE( date { 1 , 1 , 1970 }.to_time_t() == 0 );
+
+    REQUIRE( date { 29 , 2  , 2000 }.to_time_t() == 951782400    );
+    REQUIRE( date { 1  , 1  , 1900 }.to_time_t() == -2208988800  );
+    REQUIRE( date { 31 , 12 , 9999 }.to_time_t() == 253402214400 );
+    REQUIRE( date { date { 8 , 8 , 2022 }.to_time_t() } == date { 8 , 8 , 2022 } );
+}
+
+TEST_CASE( "std::chrono::sys_days interoperability" )
+{
+    using namespace project;
+    using namespace std::chrono;
+
+    constexpr year_month_day ymd { year { 2022 } , month { 8 } , day { 24 } };
+
+    STATIC_REQUIRE( date { ymd } == date { 24 , 8 , 2022 } );
+    STATIC_REQUIRE( date { sys_days { ymd } } == date { 24 , 8 , 2022 } );
+    STATIC_REQUIRE( date { 24 , 8 , 2022 }.to_sys_days() == sys_days { ymd } );
+    STATIC_REQUIRE( date { 1 , 1 , 1970 }.to_sys_days().time_since_epoch().count() == 0 );
+
+    REQUIRE( year_month_day { date { 29 , 2 , 2000 }.to_sys_days() } == 2000y / February / 29d );
+    REQUIRE( date { sys_days { 1900y / January / 1d } } == date {} );
+    REQUIRE( date { sys_days { 1900y / January / 1d } - days { 1 } } == date {} - 1 );
+    REQUIRE( weekday { date { 17 , 8 , 2564 }.to_sys_days() } == Friday );
+}
+
 TEST_CASE( "int date::year_day() const" )
 {
     project::date x1 { 9 , 6 , 2022 };
@@ -261,6 +321,32 @@ TEST_CASE( "date& date::operator--( int )" )
     REQUIRE( temp == date { 31 , 12 , 2000 } );
 }
 
+TEST_CASE( "short steps match the serial round trip" )
+{
+    using project::date;
+
+    STATIC_REQUIRE( ++date { 28 , 2 , 2000 } == date { 29 , 2 , 2000 } );
+    STATIC_REQUIRE( ++date { 31 , 12 , 1999 } == date { 1 , 1 , 2000 } );
+    STATIC_REQUIRE( --date { 1 , 3 , 1900 } == date { 28 , 2 , 1900 } );
+    STATIC_REQUIRE( date { 31 , 1 , 2001 } + 31 == date { 3 , 3 , 2001 } );
+
+    bool correct { true };
+
+    for ( int serial { date { 1 , 1 , 1900 }.serial() } ; serial < date { 1 , 1 , 2401 }.serial() ; ++serial )
+    {
+        date d { date::from_serial( serial ) };
+
+        correct &= ( date { d }++ ).serial() == serial && ( ++date { d } ).serial() == serial + 1;
+        correct &= serial == date { 1 , 1 , 1900 }.serial() || ( --date { d } ).serial() == serial - 1;
+
+        for ( int step { -40 } ; step <= 40 ; step += 3 )
+            if ( serial + step >= date { 1 , 1 , 1900 }.serial() )
+                correct &= ( date { d } += step ).serial() == serial + step;
+    }
+
+    REQUIRE( correct );
+}
+
 TEST_CASE( "operator<( const date& x , const date& y )" )
 {
     project::date x  { 8 , 6 , 2022 };
@@ -329,6 +415,69 @@ TEST_CASE( "operator!=( const date& x , const date& y )" )
     REQUIRE( x != y );
 }
 
+TEST_CASE( "std::strong_ordering operator<=>( const date& x , const date& y )" )
+{
+    using project::date;
+
+    STATIC_REQUIRE( ( date { 8 , 6 , 2022 } <=> date { 8 , 6 , 2022 } ) == std::strong_ordering::equal );
+    STATIC_REQUIRE( ( date { 31 , 12 , 2021 } <=> date { 1 , 1 , 2022 } ) == std::strong_ordering::less );
+    STATIC_REQUIRE( ( date { 1 , 2 , 2022 } <=> date { 31 , 1 , 2022 } ) == std::strong_ordering::greater );
+    STATIC_REQUIRE( ( date { 1 , 1 , 999999 } <=> date { 31 , 12 , 999998 } ) == std::strong_ordering::greater );
+
+    std::vector<date> dates ( 1024 );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    bool correct { true };
+
+    for ( std::size_t i { 1 } ; i < dates.size() ; ++i )
+    {
+        const date& x { dates[ i - 1 ] };
+        const date& y { dates[ i ] };
+
+        correct &= ( x < y ) == ( x - y < 0 );
+        correct &= ( x == y ) == ( x - y == 0 );
+    }
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "std::hash<date>" )
+{
+    using namespace project;
+
+    STATIC_REQUIRE( std::hash<date> {}( date { 9 , 6 , 2022 } ) == std::hash<serial_date> {}( serial_date { date { 9 , 6 , 2022 } } ) );
+
+    std::vector<std::size_t> hashes;
+    std::array<int , 64>     buckets {};
+
+    for ( date d { 1 , 1 , 1900 } ; d < date { 1 , 1 , 2100 } ; ++d )
+    {
+        hashes.push_back( std::hash<date> {}( d ) );
+        ++buckets[ hashes.back() % buckets.size() ];
+    }
+
+    std::sort( hashes.begin() , hashes.end() );
+
+    REQUIRE( std::adjacent_find( hashes.begin() , hashes.end() ) == hashes.end() );
+
+    // Consecutive days must spread evenly over power-of-two tables too.
+    auto [ lo , hi ] = std::minmax_element( buckets.begin() , buckets.end() );
+
+    REQUIRE( *lo > int( hashes.size() / buckets.size() * 8 / 10 ) );
+    REQUIRE( *hi < int( hashes.size() / buckets.size() * 12 / 10 ) );
+
+    std::unordered_map<date , int> counts;
+
+    ++counts[ date { 9 , 6 , 2022 } ];
+    ++counts[ date { 9 , 6 , 2022 } ];
+    ++counts[ date { 10 , 6 , 2022 } ];
+
+    REQUIRE( counts.size() == 2 );
+    REQUIRE( counts[ date { 9 , 6 , 2022 } ] == 2 );
+}
+
 TEST_CASE( "std::ostream& operator<<( std::ostream& os , const date& )" )
 {
     std::stringstream ss1;
@@ -436,4 +585,527 @@ TEST_CASE( "date::day operator--( date::day& , int )" )
     REQUIRE( day-- == date::day::sunday   );
     REQUIRE( day-- == date::day::saturday );
     REQUIRE( day   == date::day::friday   );
-}
\ No newline at end of file
+}
+
+TEST_CASE( "int date::serial() const" )
+{
+    using namespace project;
+
+    REQUIRE( date { 1  , 1 , 2000 }.serial() == 730119 );
+    REQUIRE( date { 31 , 3 , 2000 }.serial() == 730209 );
+    REQUIRE( date { 11 , 4 , 2022 } - date { 1 , 12 , 2000 } ==
+             date { 11 , 4 , 2022 }.serial() - date { 1 , 12 , 2000 }.serial() );
+}
+
+TEST_CASE( "serial_date::serial_date()" )
+{
+    using namespace project;
+
+    serial_date d;
+
+    REQUIRE( sizeof( serial_date ) == 4 );
+    REQUIRE( d.to_date() == date {} );
+}
+
+TEST_CASE( "serial_date::serial_date( const date& )" )
+{
+    using namespace project;
+
+    serial_date d { date { 24 , 8 , 2022 } };
+
+    REQUIRE( d.days()      == date { 24 , 8 , 2022 }.serial() );
+    REQUIRE( d.to_date()   == date { 24 , 8 , 2022 } );
+    REQUIRE( d.month_day() == 24   );
+    REQUIRE( d.month()     == 8    );
+    REQUIRE( d.year()      == 2022 );
+    REQUIRE( d.year_day()  == 236  );
+}
+
+TEST_CASE( "date::day serial_date::week_day() const" )
+{
+    using namespace project;
+
+    REQUIRE( serial_date { date { 11 , 2  , 1978 } }.week_day() == date::day::saturday );
+    REQUIRE( serial_date { date { 9  , 6  , 2022 } }.week_day() == date::day::thursday );
+    REQUIRE( serial_date { date { 4  , 11 , 2001 } }.week_day() == date::day::sunday   );
+    REQUIRE( serial_date { date { 17 , 8  , 2564 } }.week_day() == date::day::friday   );
+}
+
+TEST_CASE( "serial_date arithmetic" )
+{
+    using namespace project;
+
+    serial_date x1 { date { 1  , 1 , 2000 } };
+    serial_date x2 { date { 24 , 8 , 2022 } };
+
+    REQUIRE( ( x1 + 366   ).to_date() == date { 1  , 1  , 2001 } );
+    REQUIRE( ( x1 + 4565  ).to_date() == date { 1  , 7  , 2012 } );
+    REQUIRE( ( x1 - 55    ).to_date() == date { 7  , 11 , 1999 } );
+    REQUIRE( ( x2 + 95332 ).to_date() == date { 28 , 8  , 2283 } );
+    REQUIRE( ( 5 + x1     ).to_date() == date { 6  , 1  , 2000 } );
+    REQUIRE( ( x1 += 31 ).to_date() == date { 1 , 2 , 2000 } );
+    REQUIRE( ( x1 -= 1  ).to_date() == date { 31 , 1 , 2000 } );
+    REQUIRE( ( ++x1 ).to_date() == date { 1 , 2 , 2000 } );
+    REQUIRE( ( --x1 ).to_date() == date { 31 , 1 , 2000 } );
+    REQUIRE( ( x1++ ).to_date() == date { 31 , 1 , 2000 } );
+    REQUIRE( ( x1-- ).to_date() == date { 1 , 2 , 2000 } );
+    REQUIRE( serial_date { date { 11 , 4 , 2022 } } - serial_date { date { 1 , 12 , 2000 } } == 7801 );
+}
+
+TEST_CASE( "serial_date comparison" )
+{
+    using namespace project;
+
+    serial_date x { date { 8 , 6 , 2022 } };
+    serial_date y { date { 9 , 6 , 2022 } };
+
+    REQUIRE( x <  y );
+    REQUIRE( x <= y );
+    REQUIRE( y >  x );
+    REQUIRE( y >= x );
+    REQUIRE( x != y );
+    REQUIRE( x == serial_date { date { 8 , 6 , 2022 } } );
+}
+
+TEST_CASE( "date date::from_serial( int days )" )
+{
+    using namespace project;
+
+    REQUIRE( date::from_serial( 730119 ) == date { 1  , 1  , 2000 } );
+    REQUIRE( date::from_serial( 730178 ) == date { 29 , 2  , 2000 } );
+    REQUIRE( date::from_serial( 730484 ) == date { 31 , 12 , 2000 } );
+    REQUIRE( date::from_serial( date::days_since_111( date::MAX_YEAR ) ) == date { 1 , 1 , date::MAX_YEAR } );
+    REQUIRE( date::from_serial( date::days_since_111( date::MAX_YEAR + 1 ) - 1 ) == date { 31 , 12 , date::MAX_YEAR } );
+
+    bool correct { true };
+
+    for ( int days { date {}.serial() } ; days < date { 1 , 1 , 2400 }.serial() ; ++days )
+    {
+        date d { date::from_serial( days ) };
+
+        correct = correct && d.serial() == days;
+        correct = correct && d < date::from_serial( days + 1 );
+    }
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "date::operator+=( int ) with large offsets" )
+{
+    using namespace project;
+
+    int to_max_year { date::days_since_111( date::MAX_YEAR ) - date {}.serial() };
+
+    REQUIRE( ( date {} += to_max_year ) == date { 1 , 1 , date::MAX_YEAR } );
+    REQUIRE( ( date { 1 , 1 , date::MAX_YEAR } -= to_max_year ) == date {} );
+    REQUIRE( ( date { 1 , 3 , 2000 } += 146097 * 10 ) == date { 1 , 3 , 6000 } );
+    REQUIRE( ( date { 28 , 2 , 2100 } += 1 ) == date { 1 , 3 , 2100 } );
+    REQUIRE( ( date { 28 , 2 , 2400 } += 1 ) == date { 29 , 2 , 2400 } );
+}
+
+TEST_CASE( "constexpr date" )
+{
+    using namespace project;
+
+    constexpr date x { 24 , 8 , 2022 };
+    constexpr date holidays[] {
+        date { 1 , 1 , 2022 } ,
+        date { 1 , 1 , 2022 } + 365 ,
+        date { 1 , 1 , 2024 }
+    };
+
+    STATIC_REQUIRE( x.month_day() == 24  );
+    STATIC_REQUIRE( x.month()     == 8   );
+    STATIC_REQUIRE( x.year()      == 2022 );
+    STATIC_REQUIRE( x.year_day()  == 236 );
+    STATIC_REQUIRE( x.week_day()  == date::day::wednesday );
+    STATIC_REQUIRE( x.serial()    == 738390 );
+    STATIC_REQUIRE( x + 95332 == date { 28 , 8 , 2283 } );
+    STATIC_REQUIRE( x - 1 <  x );
+    STATIC_REQUIRE( x + 1 >  x );
+    STATIC_REQUIRE( x + 0 <= x );
+    STATIC_REQUIRE( x - 0 >= x );
+    STATIC_REQUIRE( x + 1 != x );
+    STATIC_REQUIRE( x - date { 1 , 12 , 2000 } == 7936 );
+    STATIC_REQUIRE( date { x }.set( 12 , 3 , 1979 ) == date { 12 , 3 , 1979 } );
+    STATIC_REQUIRE( ++date { x } == date { 25 , 8 , 2022 } );
+    STATIC_REQUIRE( --date { x } == date { 23 , 8 , 2022 } );
+    STATIC_REQUIRE( holidays[ 1 ] == date { 1 , 1 , 2023 } );
+    STATIC_REQUIRE( holidays[ 2 ] - holidays[ 1 ] == 365 );
+    STATIC_REQUIRE( serial_date { x }.to_date() == x );
+    STATIC_REQUIRE( ( serial_date { x } + 7 ).week_day() == date::day::wednesday );
+}
+
+TEST_CASE( "std::from_chars_result date::from_chars( const char* , const char* , date& )" )
+{
+    using namespace project;
+
+    date d;
+
+    std::string_view v1 { "21/08/2022 rest" };
+    auto r1 = date::from_chars( v1.data() , v1.data() + v1.size() , d );
+
+    REQUIRE( r1.ec  == std::errc {} );
+    REQUIRE( r1.ptr == v1.data() + 10 );
+    REQUIRE( d      == date { 21 , 8 , 2022 } );
+
+    std::string_view v2 { "21/08/20223" };
+    auto r2 = date::from_chars( v2.data() , v2.data() + v2.size() , d );
+
+    REQUIRE( r2.ec  == std::errc {} );
+    REQUIRE( r2.ptr == v2.data() + 11 );
+    REQUIRE( d      == date { 21 , 8 , 20223 } );
+
+    std::string_view v3 { "21-08-2022" };
+    auto r3 = date::from_chars( v3.data() , v3.data() + v3.size() , d );
+
+    REQUIRE( r3.ec  == std::errc::invalid_argument );
+    REQUIRE( r3.ptr == v3.data() );
+    REQUIRE( d      == date { 21 , 8 , 20223 } );
+
+    std::string_view v4 { "29/02/2022" };
+    auto r4 = date::from_chars( v4.data() , v4.data() + v4.size() , d );
+
+    REQUIRE( r4.ec  == std::errc::result_out_of_range );
+    REQUIRE( r4.ptr == v4.data() + 10 );
+
+    std::string_view v5 { "01/01/1000000" };
+    REQUIRE( date::from_chars( v5.data() , v5.data() + v5.size() , d ).ec == std::errc::result_out_of_range );
+
+    std::string_view v6 { "1/1/2022" };
+    REQUIRE( date::from_chars( v6.data() , v6.data() + v6.size() , d ).ec == std::errc::invalid_argument );
+}
+
+TEST_CASE( "std::optional<date> date::parse( std::string_view )" )
+{
+    using namespace project;
+
+    REQUIRE( date::parse( "15/05/2022" ) == date { 15 , 5 , 2022 } );
+    REQUIRE( date::parse( "29/02/2000" ) == date { 29 , 2 , 2000 } );
+    REQUIRE( !date::parse( "29/02/1900" ) );
+    REQUIRE( !date::parse( "00/05/2022" ) );
+    REQUIRE( !date::parse( "15/13/2022" ) );
+    REQUIRE( !date::parse( "15/05/1899" ) );
+    REQUIRE( !date::parse( "15/05/2022 " ) );
+    REQUIRE( !date::parse( "15/05/22" ) );
+    REQUIRE( !date::parse( "" ) );
+    STATIC_REQUIRE( *date::parse( "24/08/2022" ) == date { 24 , 8 , 2022 } );
+    STATIC_REQUIRE( date { std::string_view { "24/08/2022" } } == date { 24 , 8 , 2022 } );
+    REQUIRE_THROWS_AS( date { std::string_view { "24/8/2022" } } , std::invalid_argument );
+}
+
+TEST_CASE( "std::istream& operator>>( std::istream& is , date& ) failure" )
+{
+    std::stringstream ss { "21/8/2022 21/08/2022" };
+
+    project::date x { 1 , 1 , 2000 };
+
+    ss >> x;
+
+    REQUIRE( ss.fail() );
+    REQUIRE( x == project::date { 1 , 1 , 2000 } );
+
+    ss.clear();
+    ss >> x;
+
+    REQUIRE( x == project::date { 21 , 8 , 2022 } );
+}
+
+TEST_CASE( "std::to_chars_result date::to_chars( char* , char* ) const" )
+{
+    using namespace project;
+
+    char buf[ date::MAX_CHARS ] {};
+
+    auto r1 = date { 21 , 8 , 2022 }.to_chars( buf , buf + sizeof buf );
+
+    REQUIRE( r1.ec == std::errc {} );
+    REQUIRE( std::string_view { buf , std::size_t( r1.ptr - buf ) } == "21/08/2022" );
+
+    auto r2 = date { 1 , 12 , date::MAX_YEAR }.to_chars( buf , buf + sizeof buf );
+
+    REQUIRE( r2.ec == std::errc {} );
+    REQUIRE( std::string_view { buf , std::size_t( r2.ptr - buf ) } == "01/12/999999" );
+
+    auto r3 = ( date {} - 365 * 1500 ).to_chars( buf , buf + sizeof buf );
+
+    REQUIRE( std::string_view { buf , std::size_t( r3.ptr - buf ) } == "30/12/0400" );
+
+    auto r4 = date { 21 , 8 , 2022 }.to_chars( buf , buf + 9 );
+
+    REQUIRE( r4.ec  == std::errc::value_too_large );
+    REQUIRE( r4.ptr == buf + 9 );
+}
+
+TEST_CASE( "OutputIt format_to( OutputIt , const date& )" )
+{
+    using namespace project;
+
+    std::string str { "due: " };
+
+    format_to( std::back_inserter( str ) , date { 5 , 6 , 2000 } );
+
+    REQUIRE( str == "due: 05/06/2000" );
+
+    constexpr auto formatted = [] {
+        std::array<char , 10> buf {};
+        format_to( buf.begin() , date { 24 , 8 , 2022 } );
+        return buf;
+    }();
+
+    STATIC_REQUIRE( std::string_view { formatted.data() , formatted.size() } == "24/08/2022" );
+}
+
+TEST_CASE( "operator<< leaves the stream state untouched" )
+{
+    std::stringstream ss;
+
+    ss << std::setfill( '*' ) << project::date { 1 , 2 , 2003 } << ' ' << std::setw( 3 ) << 7;
+
+    REQUIRE( ss.str() == "01/02/2003 **7" );
+}
+
+TEST_CASE( "packed_date::packed_date( const date& )" )
+{
+    using namespace project;
+
+    constexpr packed_date d { date { 24 , 8 , 2022 } };
+
+    STATIC_REQUIRE( sizeof( packed_date ) == 4 );
+    STATIC_REQUIRE( d.month_day() == 24   );
+    STATIC_REQUIRE( d.month()     == 8    );
+    STATIC_REQUIRE( d.year()      == 2022 );
+    STATIC_REQUIRE( d.to_date()   == date { 24 , 8 , 2022 } );
+    STATIC_REQUIRE( packed_date {}.to_date() == date {} );
+    STATIC_REQUIRE( packed_date::from_bits( d.bits() ) == d );
+    STATIC_REQUIRE( packed_date { date { 31 , 12 , date::MAX_YEAR } }.to_date() == date { 31 , 12 , date::MAX_YEAR } );
+}
+
+TEST_CASE( "packed_date ordering matches date ordering" )
+{
+    using namespace project;
+
+    bool correct { true };
+
+    for ( int i {} ; i < 100000 ; ++i )
+    {
+        date x { date::random() };
+        date y { date::random() };
+
+        correct = correct && ( packed_date { x } <  packed_date { y } ) == ( x <  y );
+        correct = correct && ( packed_date { x } == packed_date { y } ) == ( x == y );
+        correct = correct && ( packed_date { x }.bits() < packed_date { x + 1 }.bits() );
+    }
+
+    REQUIRE( correct );
+    REQUIRE( packed_date { date { 31 , 12 , 1999 } } < packed_date { date { 1 , 1 , 2000 } } );
+    REQUIRE( packed_date { date { 31 , 1 , 2000 } } <= packed_date { date { 1 , 2 , 2000 } } );
+    REQUIRE( packed_date { date { 2 , 1 , 2000 } } > packed_date { date { 1 , 1 , 2000 } } );
+    REQUIRE( packed_date { date { 2 , 1 , 2000 } } >= packed_date { date { 2 , 1 , 2000 } } );
+    REQUIRE( packed_date { date { 2 , 1 , 2000 } } != packed_date { date { 1 , 1 , 2000 } } );
+}
+
+TEST_CASE( "date& date::operator+=( int day ) benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates  ( 1024 );
+    std::vector<int>  shifts ( 1024 );
+    std::mt19937      gen    { 42 };
+    std::uniform_int_distribution<> dist { -20000 , 20000 };
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    for ( auto& s : shifts )
+        s = dist( gen );
+
+    BENCHMARK( "1024 x date::operator+=( int )" )
+    {
+        int sum {};
+
+        for ( std::size_t i {} ; i < dates.size() ; ++i )
+            sum += ( date { dates[ i ] } += shifts[ i ] ).month_day();
+
+        return sum;
+    };
+}
+
+static project::date::day doomsday_week_day( const project::date& d )
+{
+    using project::date;
+
+    int n_digits { int( std::log10( d.year() ) ) + 1 };
+    int td       { d.year() % int( std::pow( 10 , n_digits - 2 ) ) };
+    int c1       { td / 12 };
+    int c2       { td - c1 * 12 };
+    int c3       { c2 / 4 };
+    int anchor   { ( d.year() - 200 ) % 400 / 100 };
+
+    date::day anchor_day {
+        anchor == 0 ? date::day::friday    :
+        anchor == 1 ? date::day::wednesday :
+        anchor == 2 ? date::day::tuesday   :
+                      date::day::sunday
+    };
+    date::day dooms_week_day {
+        ( c1 + c2 + c3 + int( anchor_day ) ) % 7
+    };
+    date dooms_day { 4 , 4 , d.year() };
+
+    int diff {
+        d.year_day() - dooms_day.year_day()
+    };
+
+    return date::day(
+        ( ( diff % 7 ) + 7 + int( dooms_week_day ) ) % 7
+    );
+}
+
+TEST_CASE( "date& date::operator++() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    date first { 1 , 1 , 1940 };
+    date last  { 1 , 1 , 2020 };
+
+    BENCHMARK( "80 years, daily loop with ++d" )
+    {
+        int sum {};
+
+        for ( date d { first } ; d < last ; ++d )
+            sum += d.month_day();
+
+        return sum;
+    };
+
+    BENCHMARK( "80 years, daily loop with from_serial()" )
+    {
+        int sum {};
+
+        for ( int serial { first.serial() } ; serial < last.serial() ; ++serial )
+            sum += date::from_serial( serial ).month_day();
+
+        return sum;
+    };
+
+    BENCHMARK( "80 years, weekly loop with d += 7" )
+    {
+        int sum {};
+
+        for ( date d { first } ; d < last ; d += 7 )
+            sum += d.month_day();
+
+        return sum;
+    };
+}
+
+TEST_CASE( "day date::week_day() const benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates ( 1024 );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    for ( auto& d : dates )
+        REQUIRE( d.week_day() == doomsday_week_day( d ) );
+
+    BENCHMARK( "1024 x doomsday week day" )
+    {
+        int sum {};
+
+        for ( const auto& d : dates )
+            sum += int( doomsday_week_day( d ) );
+
+        return sum;
+    };
+
+    BENCHMARK( "1024 x date::week_day()" )
+    {
+        int sum {};
+
+        for ( const auto& d : dates )
+            sum += int( d.week_day() );
+
+        return sum;
+    };
+}
+
+TEST_CASE( "int date::year_day() const benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> x ( 1024 );
+    std::vector<date> y ( 1024 );
+
+    for ( auto& d : x )
+        d = date::random();
+
+    for ( auto& d : y )
+        d = date::random();
+
+    BENCHMARK( "1024 x date::year_day()" )
+    {
+        int sum {};
+
+        for ( const auto& d : x )
+            sum += d.year_day();
+
+        return sum;
+    };
+
+    BENCHMARK( "1024 x operator-( const date& , const date& )" )
+    {
+        int sum {};
+
+        for ( std::size_t i {} ; i < x.size() ; ++i )
+            sum += x[ i ] - y[ i ];
+
+        return sum;
+    };
+}
+
+TEST_CASE( "operator<=>( const date& , const date& ) benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates ( 100000 );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    std::set<date>                 tree  ( dates.begin() , dates.end() );
+    std::unordered_map<date , int> table;
+
+    for ( const auto& d : dates )
+        ++table[ d ];
+
+    BENCHMARK_ADVANCED( "std::sort 100000 dates" )( Catch::Benchmark::Chronometer meter )
+    {
+        std::vector<date> work { dates };
+
+        meter.measure( [ & ] { std::sort( work.begin() , work.end() ); } );
+    };
+
+    BENCHMARK( "100000 x std::set<date>::find" )
+    {
+        std::size_t found {};
+
+        for ( const auto& d : dates )
+            found += tree.find( d ) != tree.end();
+
+        return found;
+    };
+
+    BENCHMARK( "100000 x std::unordered_map<date , int>::find" )
+    {
+        std::size_t found {};
+
+        for ( const auto& d : dates )
+            found += table.find( d ) != table.end();
+
+        return found;
+    };
+}
@@ -5,12 +5,18 @@
 
 #include <ctime>
 #include <cassert>
+#include <cstdint>
+#include <compare>
+#include <array>
+#include <charconv>
+#include <functional>
+#include <chrono>
 #include <iosfwd>
 #include <iomanip>
-#include <tuple>
 #include <stdexcept>
 #include <string_view>
-#include <string>
+#include <optional>
+#include <system_error>
 #include <random>
 
 namespace project
@@ -24,6 +30,10 @@ public:
     static constexpr int BASE_YEAR     = 1900;
     static constexpr int RAND_MIN_YEAR = 1940;
     static constexpr int RAND_MAX_YEAR = 2020;
+    static constexpr int MAX_YEAR      = 999999;
+    static constexpr int MAX_CHARS     = 12;
+    static constexpr int EPOCH_SERIAL  = 719162;
+    static constexpr int DAY_SECONDS   = 86400;
 
     enum class day
     {
@@ -37,43 +47,86 @@ public:
     };
 
     [[nodiscard]] static inline date random();
+    [[nodiscard]] static constexpr date from_serial( int days );
+    [[nodiscard]] static constexpr std::from_chars_result from_chars( const char* first , const char* last , date& value );
+    [[nodiscard]] static constexpr std::optional<date> parse( std::string_view );
     [[nodiscard]] static constexpr int days_since_111( int year );
     [[nodiscard]] static constexpr bool is_leap( int year );
-
-    inline date();
-    inline date( int day , int month , int year );
-    inline explicit date( std::string_view );
-    inline explicit date( std::time_t );
-    [[nodiscard]] inline int month_day() const;
-    [[nodiscard]] inline int month() const;
-    [[nodiscard]] inline int year() const;
-    [[nodiscard]] inline int year_day() const;
-    [[nodiscard]] inline day week_day() const;
-
-    inline date& set_month_day( int );
-    inline date& set_month( int );
-    inline date& set_year( int );
-    inline date& set( int day , int month , int year );
-
-    [[nodiscard]] inline date operator+( int day ) const;
-    [[nodiscard]] inline date operator-( int day ) const;
-    inline date& operator+=( int day );
-    inline date& operator-=( int day );
-    inline date& operator++();
-    inline date  operator++( int );
-    inline date& operator--();
-    inline date  operator--( int );
+    [[nodiscard]] static constexpr int n_days( int month , int year );
+
+    constexpr date();
+    constexpr date( int day , int month , int year );
+    constexpr explicit date( std::string_view );
+    constexpr explicit date( std::time_t );
+    constexpr explicit date( std::chrono::sys_days );
+    constexpr explicit date( const std::chrono::year_month_day& );
+    [[nodiscard]] constexpr int month_day() const;
+    [[nodiscard]] constexpr int month() const;
+    [[nodiscard]] constexpr int year() const;
+    [[nodiscard]] constexpr int year_day() const;
+    [[nodiscard]] constexpr day week_day() const;
+    [[nodiscard]] constexpr int serial() const;
+    [[nodiscard]] constexpr std::to_chars_result to_chars( char* first , char* last ) const;
+    [[nodiscard]] constexpr std::time_t to_time_t() const;
+    [[nodiscard]] constexpr std::chrono::sys_days to_sys_days() const;
+
+    constexpr date& set_month_day( int );
+    constexpr date& set_month( int );
+    constexpr date& set_year( int );
+    constexpr date& set( int day , int month , int year );
+
+    [[nodiscard]] constexpr date operator+( int day ) const;
+    [[nodiscard]] constexpr date operator-( int day ) const;
+    constexpr date& operator+=( int day );
+    constexpr date& operator-=( int day );
+    constexpr date& operator++();
+    constexpr date  operator++( int );
+    constexpr date& operator--();
+    constexpr date  operator--( int );
     
-    friend bool operator<( const date& , const date& );
+    friend constexpr std::strong_ordering operator<=>( const date& , const date& );
+    friend constexpr bool operator==( const date& , const date& );
 
 private:
 
-    [[nodiscard]] static inline int n_days( int month , int year );
-    [[nodiscard]] static inline int year_from_days( int days );
-    [[nodiscard]] static inline day anchor_day( int year );
-    static inline void validate_month( int );
-    static inline void validate_year( int );
-    inline void validate_day( int ) const;
+    // Largest operator+= step handled by rolling the day field in place.
+    static constexpr int SHORT_STEP = 31;
+
+    static constexpr int DAYS_IN_MONTH[ 13 ] {
+        0 , 31 , 28 , 31 , 30 , 31 , 30 , 31 , 31 , 30 , 31 , 30 , 31
+    };
+
+    // DAYS_BEFORE_MONTH[ is_leap( year ) ][ month ]
+    static constexpr auto DAYS_BEFORE_MONTH = [] {
+        std::array<std::array<int , 13> , 2> table {};
+
+        for ( int leap { 0 } ; leap < 2 ; ++leap )
+            for ( int month { 2 } ; month <= 12 ; ++month )
+                table[ leap ][ month ] = table[ leap ][ month - 1 ] +
+                                         DAYS_IN_MONTH[ month - 1 ] +
+                                         ( leap && month == 3 );
+
+        return table;
+    }();
+
+    static constexpr char DIGIT_PAIRS[] {
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899"
+    };
+
+    static constexpr void write_2_digits( char* p , int value );
+    static constexpr void validate_month( int );
+    static constexpr void validate_year( int );
+    constexpr void validate_day( int ) const;
+    [[nodiscard]] constexpr std::uint32_t key() const;
 
     int m_day;
     int m_month;
@@ -97,6 +150,75 @@ date date::random()
     return date { day , month , year };
 }
 
+constexpr date date::from_serial( int days )
+{
+    // Neri & Schneider, "Euclidean affine functions and their application
+    // to calendar algorithms". Years are counted from 01/03/0000 so that the
+    // leap day is the last day of a computational year.
+    std::uint32_t n_0 { std::uint32_t( days ) + 306 };
+    std::uint32_t n_1 { 4 * n_0 + 3 };
+    std::uint32_t c   { n_1 / 146097 };
+    std::uint32_t n_c { n_1 % 146097 / 4 };
+    std::uint64_t p_2 { std::uint64_t( 2939745 ) * ( 4 * n_c + 3 ) };
+    std::uint32_t z   { std::uint32_t( p_2 >> 32 ) };
+    std::uint32_t n_y { std::uint32_t( p_2 ) / 11758980 };
+    std::uint32_t n_3 { 2141 * n_y + 197913 };
+    std::uint32_t j   { n_y >= 306 };
+
+    date d;
+
+    d.m_year  = int( 100 * c + z + j );
+    d.m_month = int( ( n_3 >> 16 ) - 12 * j );
+    d.m_day   = int( ( n_3 & 0xFFFF ) / 2141 + 1 );
+
+    return d;
+}
+
+constexpr std::from_chars_result date::from_chars( const char* first , const char* last , date& value )
+{
+    auto digit = [] ( const char* p ) { return *p >= '0' && *p <= '9'; };
+
+    if ( last - first < 10 ||
+         !digit( first + 0 ) || !digit( first + 1 ) || first[ 2 ] != '/' ||
+         !digit( first + 3 ) || !digit( first + 4 ) || first[ 5 ] != '/' ||
+         !digit( first + 6 ) || !digit( first + 7 ) || !digit( first + 8 ) || !digit( first + 9 ) )
+        return { first , std::errc::invalid_argument };
+
+    int day   { ( first[ 0 ] - '0' ) * 10 + ( first[ 1 ] - '0' ) };
+    int month { ( first[ 3 ] - '0' ) * 10 + ( first[ 4 ] - '0' ) };
+    int year  {};
+
+    const char* ptr { first + 6 };
+
+    for ( ; ptr != last && digit( ptr ) ; ++ptr )
+        if ( ptr - first < 12 )
+            year = year * 10 + ( *ptr - '0' );
+
+    if ( ptr - first > 12 ||
+         year  < BASE_YEAR ||
+         month < 1 || month > 12 ||
+         day   < 1 || day > n_days( month , year ) )
+        return { ptr , std::errc::result_out_of_range };
+
+    value.m_day   = day;
+    value.m_month = month;
+    value.m_year  = year;
+
+    return { ptr , std::errc {} };
+}
+
+constexpr std::optional<date> date::parse( std::string_view v )
+{
+    date d;
+
+    auto [ ptr , ec ] = from_chars( v.data() , v.data() + v.size() , d );
+
+    if ( ec != std::errc {} || ptr != v.data() + v.size() )
+        return std::nullopt;
+
+    return d;
+}
+
 constexpr bool date::is_leap( int year )
 {
     return year % 4   == 0 &&
@@ -104,13 +226,13 @@ constexpr bool date::is_leap( int year )
            year % 400 == 0;
 }
 
-date::date()
+constexpr date::date()
     :   m_day   { 1 }
     ,   m_month { 1 }
     ,   m_year  { BASE_YEAR }
 {}
 
-date::date( int day , int month , int year )
+constexpr date::date( int day , int month , int year )
     :   m_day   { day }
     ,   m_month { month }
     ,   m_year  { year }
@@ -120,101 +242,102 @@ date::date( int day , int month , int year )
     validate_month( m_month );
 }
 
-date::date( std::string_view v )
+constexpr date::date( std::string_view v )
+    :   date {}
 {
-    m_day = stoi(
-        std::string { v.substr( 0 , 2 ) }
-    );
-
-    m_month = stoi(
-        std::string { v.substr( 3 , 2 ) }
-    );
-
-    m_year = stoi(
-        std::string { v.substr( 6 , 4 ) }
-    );
-    
-    validate_year( m_year );
-    validate_day( m_day );
-    validate_month( m_month );
+    if ( from_chars( v.data() , v.data() + v.size() , *this ).ec != std::errc {} )
+        throw std::invalid_argument { "date: expected DD/MM/YYYY" };
 }
 
-date::date( std::time_t gmt )
-{
-    auto tm = std::gmtime( &gmt );
+constexpr date::date( std::time_t gmt )
+    :   date {
+            from_serial(
+                int( gmt / DAY_SECONDS - ( gmt % DAY_SECONDS < 0 ) ) + EPOCH_SERIAL
+            )
+        }
+{}
 
-    assert( tm );
+constexpr date::date( std::chrono::sys_days days )
+    :   date { from_serial( int( days.time_since_epoch().count() ) + EPOCH_SERIAL ) }
+{}
 
-    m_year  = tm->tm_year + 1900;
-    m_month = tm->tm_mon + 1;
-    m_day   = tm->tm_mday;
-}
+constexpr date::date( const std::chrono::year_month_day& ymd )
+    :   date {
+            int( unsigned( ymd.day() ) ) ,
+            int( unsigned( ymd.month() ) ) ,
+            int( ymd.year() )
+        }
+{}
 
-int date::month_day() const
+constexpr int date::month_day() const
 {
     return m_day;
 }
 
-int date::month() const
+constexpr int date::month() const
 {
     return m_month;
 }
 
-int date::year() const
+constexpr int date::year() const
 {
     return m_year;
 }
 
-int date::year_day() const
+constexpr int date::year_day() const
 {
-    int days {};
+    return DAYS_BEFORE_MONTH[ is_leap( m_year ) ][ m_month ] + m_day;
+}
 
-    switch( m_month - 1 )
-    {
-        case 12 : days += n_days( 12 , m_year );
-        case 11 : days += n_days( 11 , m_year );
-        case 10 : days += n_days( 10 , m_year );
-        case 9  : days += n_days( 9  , m_year );
-        case 8  : days += n_days( 8  , m_year );
-        case 7  : days += n_days( 7  , m_year );
-        case 6  : days += n_days( 6  , m_year );
-        case 5  : days += n_days( 5  , m_year );
-        case 4  : days += n_days( 4  , m_year );
-        case 3  : days += n_days( 3  , m_year );
-        case 2  : days += n_days( 2  , m_year );
-        case 1  : days += n_days( 1  , m_year );
-        case 0  : days += m_day;
-    }
+constexpr date::day date::week_day() const
+{
+    return day( ( serial() + 1 ) % 7 );
+}
 
-    return days;
+constexpr int date::serial() const
+{
+    return days_since_111( m_year ) + year_day() - 1;
 }
 
-date::day date::week_day() const
+constexpr std::to_chars_result date::to_chars( char* first , char* last ) const
 {
-    int n_digits { int( std::log10( m_year ) ) + 1 };
+    int n_year_digits { 4 };
 
-    assert( n_digits >= 2 );
+    for ( int year { m_year } ; year >= 10000 ; year /= 10 )
+        ++n_year_digits;
 
-    int td { m_year % int( std::pow( 10 , n_digits - 2 ) ) };
-    int c1 { td / 12 };
-    int c2 { td - c1 * 12 };
-    int c3 { c2 / 4 };
+    if ( last - first < 6 + n_year_digits )
+        return { last , std::errc::value_too_large };
 
-    day dooms_week_day {
-        ( c1 + c2 + c3 + int( anchor_day( m_year ) ) ) % 7
-    };
-    date dooms_day { 4 , 4 , m_year };
+    write_2_digits( first , m_day );
+    first[ 2 ] = '/';
+    write_2_digits( first + 3 , m_month );
+    first[ 5 ] = '/';
 
-    int diff {
-        year_day() - dooms_day.year_day()
-    };
-    
-    return day(
-        ( ( diff % 7 ) + 7 + int( dooms_week_day ) ) % 7
-    );
+    char* year_first { first + 6 };
+    char* ptr        { year_first + n_year_digits };
+    int   year       { m_year };
+
+    for ( ; ptr - year_first >= 2 ; year /= 100 )
+        write_2_digits( ptr -= 2 , year % 100 );
+
+    if ( ptr != year_first )
+        *--ptr = char( '0' + year % 10 );
+
+    return { year_first + n_year_digits , std::errc {} };
 }
 
-date& date::set_month_day( int day )
+constexpr std::time_t date::to_time_t() const
+{
+    return std::time_t( serial() - EPOCH_SERIAL ) * DAY_SECONDS;
+}
+
+constexpr std::chrono::sys_days date::to_sys_days() const
+{
+    return std::chrono::sys_days { std::chrono::days { serial() - EPOCH_SERIAL } };
+}
+
+constexpr date& date::set_month_day( int day )
 {
     validate_day( day );
 
@@ -223,7 +346,7 @@ date& date::set_month_day( int day )
     return *this;
 }
 
-date& date::set_month( int month )
+constexpr date& date::set_month( int month )
 {
     validate_month( month );
 
@@ -232,7 +355,7 @@ date& date::set_month( int month )
     return *this;
 }
 
-date& date::set_year( int year )
+constexpr date& date::set_year( int year )
 {
     validate_year( year );
 
@@ -241,7 +364,7 @@ date& date::set_year( int year )
     return *this;
 }
 
-date& date::set( int day , int month , int year )
+constexpr date& date::set( int day , int month , int year )
 {
     set_year( year );
     set_month( month );
@@ -250,7 +373,7 @@ date& date::set( int day , int month , int year )
     return *this;
 }
 
-date date::operator+( int day ) const
+constexpr date date::operator+( int day ) const
 {
     if ( !day )
         return *this;
@@ -262,49 +385,71 @@ date date::operator+( int day ) const
     return target_date;
 }
 
-date date::operator-( int day ) const
+constexpr date date::operator-( int day ) const
 {
     return operator+( -day );
 }
 
-date& date::operator+=( int day )
+constexpr date& date::operator+=( int day )
 {
-    if ( !day )
-        return *this;
+    if ( day < -SHORT_STEP || day > SHORT_STEP )
+        return *this = from_serial( serial() + day );
+
+    // A step of at most a month crosses at most two month boundaries, so
+    // rolling the day field is cheaper than a round trip through serial().
+    m_day += day;
 
-    int current_days { days_since_111( m_year ) + year_day() - 1 };
-    int target_days  { current_days + day };
-    int target_year  { year_from_days( target_days ) };
-    int surplus_days { target_days - days_since_111( target_year ) };
-    int target_month;
+    while ( m_day > n_days( m_month , m_year ) )
+    {
+        m_day -= n_days( m_month , m_year );
 
-    for (
-            target_month = 1 ;
-            target_month < 13 && surplus_days >= n_days( target_month , target_year ); 
-            surplus_days -= n_days( target_month , target_year ) , ++target_month
-        );
+        if ( ++m_month > 12 )
+        {
+            m_month = 1;
+            ++m_year;
+        }
+    }
 
-    target_year  += target_month == 13;
-    target_month  = target_month == 13 ? 1 : target_month;
+    while ( m_day < 1 )
+    {
+        if ( --m_month < 1 )
+        {
+            m_month = 12;
+            --m_year;
+        }
 
-    m_day   = surplus_days + 1;
-    m_month = target_month;
-    m_year  = target_year;
+        m_day += n_days( m_month , m_year );
+    }
 
     return *this;
 }
 
-date& date::operator-=( int day )
+constexpr date& date::operator-=( int day )
 {
     return operator+=( -day );
 }
 
-date& date::operator++()
+constexpr date& date::operator++()
 {
-    return operator+=( 1 );
+    if ( m_day < 28 || m_day < n_days( m_month , m_year ) )
+    {
+        ++m_day;
+
+        return *this;
+    }
+
+    m_day = 1;
+
+    if ( ++m_month > 12 )
+    {
+        m_month = 1;
+        ++m_year;
+    }
+
+    return *this;
 }
 
-date date::operator++( int )
+constexpr date date::operator++( int )
 {
     date curr { *this };
 
@@ -313,12 +458,27 @@ date date::operator++( int )
     return curr;
 }
 
-date& date::operator--()
+constexpr date& date::operator--()
 {
-    return operator-=( 1 );
+    if ( m_day > 1 )
+    {
+        --m_day;
+
+        return *this;
+    }
+
+    if ( --m_month < 1 )
+    {
+        m_month = 12;
+        --m_year;
+    }
+
+    m_day = n_days( m_month , m_year );
+
+    return *this;
 }
 
-date date::operator--( int )
+constexpr date date::operator--( int )
 {
     date curr { *this };
 
@@ -327,125 +487,72 @@ date date::operator--( int )
     return curr;
 }
 
-int date::n_days( int month , int year )
+constexpr int date::n_days( int month , int year )
 {
-    switch( month )
-    {
-        default : assert( month > 0 && month <= 12 );
-        case 12 : return 31;
-        case 11 : return 30;
-        case 10 : return 31;
-        case 9  : return 30;
-        case 8  : return 31;
-        case 7  : return 31;
-        case 6  : return 30;
-        case 5  : return 31;
-        case 4  : return 30;
-        case 3  : return 31;
-        case 2  : return 28 + is_leap( year );
-        case 1  : return 31;
-    }
-}
+    assert( month > 0 && month <= 12 );
 
-constexpr int date::days_since_111( int year )
-{
-    --year;
-    return year * 365 + year / 400 - year / 100 + year / 4;
+    return DAYS_IN_MONTH[ month ] + ( month == 2 && is_leap( year ) );
 }
 
-int date::year_from_days( int days )
+constexpr void date::write_2_digits( char* p , int value )
 {
-    return days * 400 / 146097 + 1;
+    p[ 0 ] = DIGIT_PAIRS[ 2 * value ];
+    p[ 1 ] = DIGIT_PAIRS[ 2 * value + 1 ];
 }
 
-date::day date::anchor_day( int year )
+constexpr int date::days_since_111( int year )
 {
-    int century { ( year - 200 ) % 400 / 100 };
-
-    switch( century )
-    {
-        case 0 : return day::friday;
-        case 1 : return day::wednesday;
-        case 2 : return day::tuesday;
-        case 3 : return day::sunday;
-    }
+    --year;
+    return year * 365 + year / 400 - year / 100 + year / 4;
 }
 
-void date::validate_day( int day ) const
+constexpr void date::validate_day( int day ) const
 {
     assert( day > 0 );
     assert( day <= n_days( m_month , m_year ) );
 }
 
-void date::validate_month( int month )
+constexpr void date::validate_month( int month )
 {
     assert( month > 0 );
     assert( month <= 12 );
 }
 
-void date::validate_year( int year )
+constexpr void date::validate_year( int year )
 {
     assert( year >= 1900 );
+    assert( year <= MAX_YEAR );
 }
 
-[[nodiscard]] inline bool operator<( const date& x , const date& y )
-{
-    return std::tie(
-        x.m_year  ,
-        x.m_month ,
-        x.m_day
-    ) <
-    std::tie(
-        y.m_year  ,
-        y.m_month ,
-        y.m_day
-    );
-}
-
-[[nodiscard]] inline bool operator<=( const date& x , const date& y )
-{
-    return !( y < x );
-}
-
-[[nodiscard]] inline bool operator>( const date& x , const date& y )
+[[nodiscard]] constexpr std::strong_ordering operator<=>( const date& x , const date& y )
 {
-    return !( x <= y );
+    return x.key() <=> y.key();
 }
 
-[[nodiscard]] inline bool operator>=( const date& x , const date& y )
+[[nodiscard]] constexpr bool operator==( const date& x , const date& y )
 {
-    return !( x < y );
+    return x.key() == y.key();
 }
 
-[[nodiscard]] inline bool operator==( const date& x , const date& y )
-{
-    return x <= y && y <= x;
-}
-
-[[nodiscard]] inline bool operator!=( const date& x , const date& y )
-{
-    return !( x == y );
-}
-
-[[nodiscard]] inline int operator-( const date& x , const date& y )
+[[nodiscard]] constexpr int operator-( const date& x , const date& y )
 {
     return ( date::days_since_111( x.year() ) + x.year_day() ) -
            ( date::days_since_111( y.year() ) + y.year_day() );
 }
 
-[[nodiscard]] inline date operator+( int n , const date& x )
+[[nodiscard]] constexpr date operator+( int n , const date& x )
 {
     return x.operator+( n );
 }
 
-inline date::day& operator++( date::day& d )
+constexpr date::day& operator++( date::day& d )
 {
     return d = date::day(
         ( int( d ) + 1 ) % 7
     );
 }
 
-inline date::day operator++( date::day& d , int )
+constexpr date::day operator++( date::day& d , int )
 {
     date::day x { d };
 
@@ -454,14 +561,14 @@ inline date::day operator++( date::day& d , int )
     return x;
 }
 
-inline date::day& operator--( date::day& d )
+constexpr date::day& operator--( date::day& d )
 {
     return d = date::day(
         ( int( d ) + 6 ) % 7
     );
 }
 
-inline date::day operator--( date::day& d , int )
+constexpr date::day operator--( date::day& d , int )
 {
     date::day x { d };
 
@@ -470,40 +577,385 @@ inline date::day operator--( date::day& d , int )
     return x;
 }
 
+// Murmur3 finalizer over the serial day number. It is a bijection on 32 bits,
+// so distinct days never collide, and every input bit reaches every output
+// bit, so consecutive days spread over the whole table.
+[[nodiscard]] constexpr std::uint32_t hash_serial( std::int32_t serial )
+{
+    std::uint32_t h { std::uint32_t( serial ) };
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    return h;
+}
+
+template< typename OutputIt >
+constexpr OutputIt format_to( OutputIt out , const date& d )
+{
+    char buf[ date::MAX_CHARS ] {};
+
+    auto [ ptr , ec ] = d.to_chars( buf , buf + sizeof buf );
+
+    for ( const char* p { buf } ; p != ptr ; ++p )
+        *out++ = *p;
+
+    return out;
+}
+
 inline std::ostream& operator<<( std::ostream& os , const date& d )
 {
-    return os << std::setfill( '0' ) << std::setw( 2 )
-              << d.month_day()
-              << '/'
-              << std::setfill( '0' ) << std::setw( 2 )
-              << d.month()
-              << '/'
-              << d.year();
+    char buf[ date::MAX_CHARS ];
+
+    auto [ ptr , ec ] = d.to_chars( buf , buf + sizeof buf );
+
+    return os.write( buf , ptr - buf );
 }
 
 inline std::istream& operator>>( std::istream& is , date& d )
 {
-    std::string date_str;
+    char date_str[ 16 ] {};
 
-    is >> date_str;
+    is >> std::setw( sizeof date_str ) >> date_str;
 
-    auto day = std::stoi( date_str.substr( 0 , 2 ) );
+    std::string_view v { date_str };
+    date             x;
 
-    d.set_month(
-        std::stoi(
-            date_str.substr( 3 , 2 )
-        )
-    );
-    d.set_year(
-        std::stoi(
-            date_str.substr( 6 )
-        )
-    );
-    d.set_month_day( day );
+    auto [ ptr , ec ] = date::from_chars( v.data() , v.data() + v.size() , x );
+
+    if ( ec != std::errc {} || ptr != v.data() + v.size() )
+        is.setstate( std::ios_base::failbit );
+    else
+        d = x;
 
     return is;
 }
 
+class serial_date
+{
+
+public:
+
+    using rep = std::int32_t;
+
+    [[nodiscard]] static constexpr serial_date from_days( rep days );
+
+    constexpr serial_date();
+    constexpr explicit serial_date( const date& );
+    [[nodiscard]] constexpr rep days() const;
+    [[nodiscard]] constexpr date to_date() const;
+    [[nodiscard]] constexpr int month_day() const;
+    [[nodiscard]] constexpr int month() const;
+    [[nodiscard]] constexpr int year() const;
+    [[nodiscard]] constexpr int year_day() const;
+    [[nodiscard]] constexpr date::day week_day() const;
+
+    [[nodiscard]] constexpr serial_date operator+( int day ) const;
+    [[nodiscard]] constexpr serial_date operator-( int day ) const;
+    constexpr serial_date& operator+=( int day );
+    constexpr serial_date& operator-=( int day );
+    constexpr serial_date& operator++();
+    constexpr serial_date  operator++( int );
+    constexpr serial_date& operator--();
+    constexpr serial_date  operator--( int );
+
+private:
+
+    rep m_days;
+};
+
+constexpr serial_date serial_date::from_days( rep days )
+{
+    serial_date d;
+
+    d.m_days = days;
+
+    return d;
 }
 
+constexpr serial_date::serial_date()
+    :   m_days { date::days_since_111( date::BASE_YEAR ) }
+{}
+
+constexpr serial_date::serial_date( const date& d )
+    :   m_days { d.serial() }
+{}
+
+constexpr serial_date::rep serial_date::days() const
+{
+    return m_days;
+}
+
+constexpr date serial_date::to_date() const
+{
+    return date::from_serial( m_days );
+}
+
+constexpr int serial_date::month_day() const
+{
+    return to_date().month_day();
+}
+
+constexpr int serial_date::month() const
+{
+    return to_date().month();
+}
+
+constexpr int serial_date::year() const
+{
+    return to_date().year();
+}
+
+constexpr int serial_date::year_day() const
+{
+    return to_date().year_day();
+}
+
+constexpr date::day serial_date::week_day() const
+{
+    return date::day( ( m_days + 1 ) % 7 );
+}
+
+constexpr serial_date serial_date::operator+( int day ) const
+{
+    return from_days( m_days + day );
+}
+
+constexpr serial_date serial_date::operator-( int day ) const
+{
+    return from_days( m_days - day );
+}
+
+constexpr serial_date& serial_date::operator+=( int day )
+{
+    m_days += day;
+
+    return *this;
+}
+
+constexpr serial_date& serial_date::operator-=( int day )
+{
+    m_days -= day;
+
+    return *this;
+}
+
+constexpr serial_date& serial_date::operator++()
+{
+    ++m_days;
+
+    return *this;
+}
+
+constexpr serial_date serial_date::operator++( int )
+{
+    serial_date curr { *this };
+
+    operator++();
+
+    return curr;
+}
+
+constexpr serial_date& serial_date::operator--()
+{
+    --m_days;
+
+    return *this;
+}
+
+constexpr serial_date serial_date::operator--( int )
+{
+    serial_date curr { *this };
+
+    operator--();
+
+    return curr;
+}
+
+[[nodiscard]] constexpr bool operator<( const serial_date& x , const serial_date& y )
+{
+    return x.days() < y.days();
+}
+
+[[nodiscard]] constexpr bool operator<=( const serial_date& x , const serial_date& y )
+{
+    return x.days() <= y.days();
+}
+
+[[nodiscard]] constexpr bool operator>( const serial_date& x , const serial_date& y )
+{
+    return x.days() > y.days();
+}
+
+[[nodiscard]] constexpr bool operator>=( const serial_date& x , const serial_date& y )
+{
+    return x.days() >= y.days();
+}
+
+[[nodiscard]] constexpr bool operator==( const serial_date& x , const serial_date& y )
+{
+    return x.days() == y.days();
+}
+
+[[nodiscard]] constexpr bool operator!=( const serial_date& x , const serial_date& y )
+{
+    return x.days() != y.days();
+}
+
+[[nodiscard]] constexpr int operator-( const serial_date& x , const serial_date& y )
+{
+    return x.days() - y.days();
+}
+
+[[nodiscard]] constexpr serial_date operator+( int n , const serial_date& x )
+{
+    return x.operator+( n );
+}
+
+inline std::ostream& operator<<( std::ostream& os , const serial_date& d )
+{
+    return os << d.to_date();
+}
+
+class packed_date
+{
+
+public:
+
+    using rep = std::uint32_t;
+
+    static constexpr int DAY_BITS   = 5;
+    static constexpr int MONTH_BITS = 4;
+
+    [[nodiscard]] static constexpr packed_date from_bits( rep bits );
+
+    constexpr packed_date();
+    constexpr explicit packed_date( const date& );
+    [[nodiscard]] constexpr rep bits() const;
+    [[nodiscard]] constexpr date to_date() const;
+    [[nodiscard]] constexpr int month_day() const;
+    [[nodiscard]] constexpr int month() const;
+    [[nodiscard]] constexpr int year() const;
+
+private:
+
+    [[nodiscard]] static constexpr rep pack( int day , int month , int year );
+
+    rep m_bits;
+};
+
+constexpr packed_date packed_date::from_bits( rep bits )
+{
+    packed_date d;
+
+    d.m_bits = bits;
+
+    return d;
+}
+
+constexpr packed_date::packed_date()
+    :   m_bits { pack( 1 , 1 , date::BASE_YEAR ) }
+{}
+
+constexpr packed_date::packed_date( const date& d )
+    :   m_bits { pack( d.month_day() , d.month() , d.year() ) }
+{}
+
+constexpr packed_date::rep packed_date::bits() const
+{
+    return m_bits;
+}
+
+constexpr date packed_date::to_date() const
+{
+    return date { month_day() , month() , year() };
+}
+
+constexpr int packed_date::month_day() const
+{
+    return int( m_bits & ( ( 1u << DAY_BITS ) - 1 ) );
+}
+
+constexpr int packed_date::month() const
+{
+    return int( m_bits >> DAY_BITS & ( ( 1u << MONTH_BITS ) - 1 ) );
+}
+
+constexpr int packed_date::year() const
+{
+    return int( m_bits >> ( DAY_BITS + MONTH_BITS ) );
+}
+
+constexpr packed_date::rep packed_date::pack( int day , int month , int year )
+{
+    return rep( year ) << ( DAY_BITS + MONTH_BITS ) |
+           rep( month ) << DAY_BITS |
+           rep( day );
+}
+
+// The packed_date bits, so one integer compare orders ( year , month , day ).
+// Defined here so date and packed_date share a single layout.
+constexpr std::uint32_t date::key() const
+{
+    return packed_date { *this }.bits();
+}
+
+[[nodiscard]] constexpr bool operator<( const packed_date& x , const packed_date& y )
+{
+    return x.bits() < y.bits();
+}
+
+[[nodiscard]] constexpr bool operator<=( const packed_date& x , const packed_date& y )
+{
+    return x.bits() <= y.bits();
+}
+
+[[nodiscard]] constexpr bool operator>( const packed_date& x , const packed_date& y )
+{
+    return x.bits() > y.bits();
+}
+
+[[nodiscard]] constexpr bool operator>=( const packed_date& x , const packed_date& y )
+{
+    return x.bits() >= y.bits();
+}
+
+[[nodiscard]] constexpr bool operator==( const packed_date& x , const packed_date& y )
+{
+    return x.bits() == y.bits();
+}
+
+[[nodiscard]] constexpr bool operator!=( const packed_date& x , const packed_date& y )
+{
+    return x.bits() != y.bits();
+}
+
+inline std::ostream& operator<<( std::ostream& os , const packed_date& d )
+{
+    return os << d.to_date();
+}
+
+}
+
+template<>
+struct std::hash<project::date>
+{
+    [[nodiscard]] constexpr std::size_t operator()( const project::date& d ) const noexcept
+    {
+        return project::hash_serial( d.serial() );
+    }
+};
+
+template<>
+struct std::hash<project::serial_date>
+{
+    [[nodiscard]] constexpr std::size_t operator()( const project::serial_date& d ) const noexcept
+    {
+        return project::hash_serial( d.days() );
+    }
+};
+
 #endif
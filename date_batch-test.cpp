@@ -0,0 +1,488 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "date_batch.hpp"
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+TEST_CASE( "std::size_t parse_dates( const char* , std::size_t , std::span<date> )" )
+{
+    using namespace project;
+
+    std::string       column { "01/01/2000" "29/02/2000" "31/12/1999" "15/05/2022" "28/02/2100" };
+    std::vector<date> out    ( 5 );
+
+    REQUIRE( parse_dates( column.data() , 10 , out ) == 5 );
+    REQUIRE( out[ 0 ] == date { 1  , 1  , 2000 } );
+    REQUIRE( out[ 1 ] == date { 29 , 2  , 2000 } );
+    REQUIRE( out[ 2 ] == date { 31 , 12 , 1999 } );
+    REQUIRE( out[ 3 ] == date { 15 , 5  , 2022 } );
+    REQUIRE( out[ 4 ] == date { 28 , 2  , 2100 } );
+}
+
+TEST_CASE( "parse_dates() with strided records" )
+{
+    using namespace project;
+
+    std::string       csv { "24/08/2022,1\n" "25/08/2022,2\n" "26/08/2022,3\n" };
+    std::vector<date> out ( 3 );
+
+    REQUIRE( parse_dates( csv.data() , 13 , out ) == 3 );
+    REQUIRE( out[ 0 ] == date { 24 , 8 , 2022 } );
+    REQUIRE( out[ 1 ] == date { 25 , 8 , 2022 } );
+    REQUIRE( out[ 2 ] == date { 26 , 8 , 2022 } );
+}
+
+TEST_CASE( "parse_dates() stops at the first invalid record" )
+{
+    using namespace project;
+
+    std::vector<std::string> bad {
+        "01-01/2000" , "01/01/2x00" , "00/01/2000" , "32/01/2000" , "31/04/2000" ,
+        "29/02/1900" , "01/00/2000" , "01/13/2000" , "01/01/1899" , " 1/01/2000"
+    };
+
+    for ( std::size_t at : { 0 , 1 , 2 , 3 , 6 , 7 } )
+        for ( const auto& record : bad )
+        {
+            std::string column;
+
+            for ( std::size_t i {} ; i < 8 ; ++i )
+                column += i == at ? record : "17/08/2564";
+
+            std::vector<date> out ( 8 );
+
+            REQUIRE( parse_dates( column.data() , 10 , out ) == at );
+        }
+}
+
+TEST_CASE( "std::size_t format_dates( std::span<const date> , char* )" )
+{
+    using namespace project;
+
+    for ( std::size_t n : { 0 , 1 , 2 , 3 , 4 , 17 } )
+    {
+        std::vector<date> dates ( n );
+        std::string       expected;
+
+        for ( auto& d : dates )
+        {
+            d = date::random();
+
+            format_to( std::back_inserter( expected ) , d );
+        }
+
+        std::string out ( 10 * n , '?' );
+
+        REQUIRE( format_dates( dates , out.data() ) == n );
+        REQUIRE( out == expected );
+    }
+
+    std::vector<date> edges { { 1 , 1 , 1900 } , { 31 , 12 , 9999 } , { 9 , 10 , 2009 } };
+    std::string       out   ( 30 , '?' );
+
+    REQUIRE( format_dates( edges , out.data() ) == 3 );
+    REQUIRE( out == "01/01/1900" "31/12/9999" "09/10/2009" );
+}
+
+TEST_CASE( "format_dates() stops at the first year wider than 4 digits" )
+{
+    using namespace project;
+
+    for ( std::size_t at : { 0 , 1 , 2 , 3 , 6 , 7 } )
+    {
+        std::vector<date> dates ( 8 , date { 17 , 8 , 2564 } );
+        std::string       out   ( 80 , '?' );
+
+        dates[ at ] = date { 21 , 8 , 20223 };
+
+        REQUIRE( format_dates( dates , out.data() ) == at );
+
+        for ( std::size_t i {} ; i < at ; ++i )
+            REQUIRE( out.substr( 10 * i , 10 ) == "17/08/2564" );
+    }
+}
+
+TEST_CASE( "void add_days( std::span<date> , int )" )
+{
+    using namespace project;
+
+    for ( int shift : { 0 , 1 , -1 , 31 , -366 , 95332 , 146097 * 4 } )
+    {
+        std::vector<date> dates    ( 37 );
+        std::vector<date> expected ( dates.size() );
+
+        for ( std::size_t i {} ; i < dates.size() ; ++i )
+            expected[ i ] = ( dates[ i ] = date::random() ) + shift;
+
+        add_days( dates , shift );
+
+        REQUIRE( dates == expected );
+    }
+
+    std::vector<date> edges { { 28 , 2 , 2000 } , { 28 , 2 , 2100 } , { 31 , 12 , 1999 } , { 28 , 2 , 1900 } ,
+                              { 29 , 2 , 2400 } , { 1  , 3 , 2000 } , { 1  , 1  , 2000 } , { 30 , 12 , 9999 } };
+
+    add_days( edges , 1 );
+
+    REQUIRE( edges == std::vector<date> { { 29 , 2 , 2000 } , { 1 , 3 , 2100 } , { 1 , 1 , 2000 } , { 1  , 3  , 1900 } ,
+                                          { 1  , 3 , 2400 } , { 2 , 3 , 2000 } , { 2 , 1 , 2000 } , { 31 , 12 , 9999 } } );
+}
+
+TEST_CASE( "void add_days( std::span<date> , std::span<const int> )" )
+{
+    using namespace project;
+
+    std::vector<date> dates    ( 43 );
+    std::vector<int>  shifts   ( dates.size() );
+    std::vector<date> expected ( dates.size() );
+    std::mt19937      gen      { 7 };
+    std::uniform_int_distribution<> dist { -10000 , 10000 };
+
+    for ( std::size_t i {} ; i < dates.size() ; ++i )
+    {
+        dates[ i ]    = date::random();
+        shifts[ i ]   = dist( gen );
+        expected[ i ] = dates[ i ] + shifts[ i ];
+    }
+
+    add_days( dates , shifts );
+
+    REQUIRE( dates == expected );
+}
+
+TEST_CASE( "void diff_days( std::span<const date> , std::span<const date> , std::span<std::int32_t> )" )
+{
+    using namespace project;
+
+    std::vector<date>         x   ( 29 );
+    std::vector<date>         y   ( x.size() );
+    std::vector<std::int32_t> out ( x.size() );
+
+    for ( std::size_t i {} ; i < x.size() ; ++i )
+    {
+        x[ i ] = date::random();
+        y[ i ] = date::random();
+    }
+
+    x[ 0 ] = date { 11 , 4 , 2022 };
+    y[ 0 ] = date { 1  , 12 , 2000 };
+    x[ 1 ] = date { 1  , 10 , 2001 };
+    y[ 1 ] = date { 23 , 5  , 2045 };
+
+    diff_days( x , y , out );
+
+    REQUIRE( out[ 0 ] == 7801   );
+    REQUIRE( out[ 1 ] == -15940 );
+
+    for ( std::size_t i {} ; i < x.size() ; ++i )
+        REQUIRE( out[ i ] == x[ i ] - y[ i ] );
+}
+
+TEST_CASE( "void diff_days( std::span<const date> , const date& , std::span<std::int32_t> )" )
+{
+    using namespace project;
+
+    std::vector<date>         x   ( 21 );
+    std::vector<std::int32_t> out ( x.size() );
+    date                      today { 24 , 8 , 2022 };
+
+    for ( auto& d : x )
+        d = date::random();
+
+    diff_days( x , today , out );
+
+    for ( std::size_t i {} ; i < x.size() ; ++i )
+        REQUIRE( out[ i ] == x[ i ] - today );
+}
+
+TEST_CASE( "void week_days( std::span<const date> , std::span<date::day> )" )
+{
+    using namespace project;
+
+    std::vector<date>      dates ( 4099 );
+    std::vector<date::day> out   ( dates.size() );
+
+    for ( std::size_t i {} ; i < dates.size() ; ++i )
+        dates[ i ] = date { 1 , 1 , 1900 } + int( i * 89 );
+
+    dates[ 0 ] = date { 11 , 2  , 1978 };
+    dates[ 1 ] = date { 9  , 6  , 2022 };
+    dates[ 2 ] = date { 4  , 11 , 2001 };
+    dates[ 3 ] = date { 17 , 8  , 2564 };
+
+    week_days( dates , out );
+
+    REQUIRE( out[ 0 ] == date::day::saturday );
+    REQUIRE( out[ 1 ] == date::day::thursday );
+    REQUIRE( out[ 2 ] == date::day::sunday   );
+    REQUIRE( out[ 3 ] == date::day::friday   );
+
+    bool correct { true };
+
+    for ( std::size_t i {} ; i < dates.size() ; ++i )
+        correct = correct && out[ i ] == dates[ i ].week_day();
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "void from_time_t( std::span<const std::time_t> , std::span<date> )" )
+{
+    using namespace project;
+
+    std::vector<std::time_t> times { 0 , -1 , 1660000000 , 951782400 , -2208988800 , 253402300799 , 86399 , 86400 ,
+                                     -86400 , -86401 , 4102444800 , 1234567890 };
+    std::mt19937_64          gen   { 11 };
+    std::uniform_int_distribution<std::time_t> dist { -2208988800 , 253402300799 };
+
+    for ( int i {} ; i < 45 ; ++i )
+        times.push_back( dist( gen ) );
+
+    std::vector<date> out ( times.size() );
+
+    from_time_t( times , out );
+
+    for ( std::size_t i {} ; i < times.size() ; ++i )
+        REQUIRE( out[ i ] == date { times[ i ] } );
+
+    REQUIRE( out[ 1 ] == date { 31 , 12 , 1969 } );
+    REQUIRE( out[ 9 ] == date { 30 , 12 , 1969 } );
+}
+
+TEST_CASE( "void hash_dates( std::span<const date> , std::span<std::size_t> )" )
+{
+    using namespace project;
+
+    std::vector<date>        dates ( 4099 );
+    std::vector<std::size_t> out   ( dates.size() );
+
+    for ( std::size_t i {} ; i < dates.size() ; ++i )
+        dates[ i ] = date { 1 , 1 , 1900 } + int( i * 89 );
+
+    dates[ 0 ] = date { 1  , 1  , 1900 };
+    dates[ 1 ] = date { 31 , 12 , date::MAX_YEAR };
+
+    hash_dates( dates , out );
+
+    bool correct { true };
+
+    for ( std::size_t i {} ; i < dates.size() ; ++i )
+        correct = correct && out[ i ] == std::hash<date> {}( dates[ i ] );
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "parse_dates() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates ( 4096 );
+    std::string       column;
+
+    for ( auto& d : dates )
+    {
+        d = date::random();
+
+        std::ostringstream os;
+        os << d;
+        column += os.str();
+    }
+
+    std::vector<date> out ( dates.size() );
+
+    REQUIRE( parse_dates( column.data() , 10 , out ) == dates.size() );
+    REQUIRE( out == dates );
+
+    BENCHMARK( "4096 x date( std::string_view )" )
+    {
+        for ( std::size_t i {} ; i < out.size() ; ++i )
+            out[ i ] = date { std::string_view { column.data() + i * 10 , 10 } };
+
+        return out.back();
+    };
+
+    BENCHMARK( "4096 x parse_dates()" )
+    {
+        return parse_dates( column.data() , 10 , out );
+    };
+}
+
+TEST_CASE( "format_dates() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates ( 4096 );
+    std::string       out   ( 10 * dates.size() , ' ' );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    BENCHMARK( "4096 x operator<<" )
+    {
+        std::ostringstream os;
+
+        for ( const auto& d : dates )
+            os << d;
+
+        return os.tellp();
+    };
+
+    BENCHMARK( "4096 x date::to_chars()" )
+    {
+        char* p { out.data() };
+
+        for ( const auto& d : dates )
+            p = d.to_chars( p , p + 10 ).ptr;
+
+        return p;
+    };
+
+    BENCHMARK( "4096 x format_dates()" )
+    {
+        return format_dates( dates , out.data() );
+    };
+}
+
+TEST_CASE( "add_days() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> dates ( 4096 );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    BENCHMARK( "4096 x date::operator+=( int )" )
+    {
+        for ( auto& d : dates )
+            d += 7;
+
+        return dates.back();
+    };
+
+    BENCHMARK( "4096 x add_days()" )
+    {
+        add_days( dates , -7 );
+
+        return dates.back();
+    };
+}
+
+TEST_CASE( "diff_days() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date>         dates ( 4096 );
+    std::vector<std::int32_t> out   ( dates.size() );
+    date                      today { 24 , 8 , 2022 };
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    BENCHMARK( "4096 x operator-( const date& , const date& )" )
+    {
+        for ( std::size_t i {} ; i < dates.size() ; ++i )
+            out[ i ] = dates[ i ] - today;
+
+        return out.back();
+    };
+
+    BENCHMARK( "4096 x diff_days()" )
+    {
+        diff_days( dates , today , out );
+
+        return out.back();
+    };
+}
+
+TEST_CASE( "week_days() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date>      dates ( 4096 );
+    std::vector<date::day> out   ( dates.size() );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    BENCHMARK( "4096 x date::week_day()" )
+    {
+        for ( std::size_t i {} ; i < dates.size() ; ++i )
+            out[ i ] = dates[ i ].week_day();
+
+        return out.back();
+    };
+
+    BENCHMARK( "4096 x week_days()" )
+    {
+        week_days( dates , out );
+
+        return out.back();
+    };
+}
+
+TEST_CASE( "from_time_t() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<std::time_t> times ( 4096 );
+    std::vector<date>        out   ( times.size() );
+    std::mt19937_64          gen   { 11 };
+    std::uniform_int_distribution<std::time_t> dist { 0 , 4102444800 };
+
+    for ( auto& t : times )
+        t = dist( gen );
+
+    BENCHMARK( "4096 x std::gmtime()" )
+    {
+        int sum {};
+
+        for ( auto t : times )
+            sum += std::gmtime( &t )->tm_mday;
+
+        return sum;
+    };
+
+    BENCHMARK( "4096 x date( std::time_t )" )
+    {
+        for ( std::size_t i {} ; i < times.size() ; ++i )
+            out[ i ] = date { times[ i ] };
+
+        return out.back();
+    };
+
+    BENCHMARK( "4096 x from_time_t()" )
+    {
+        from_time_t( times , out );
+
+        return out.back();
+    };
+}
+
+TEST_CASE( "hash_dates() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date>        dates ( 4096 );
+    std::vector<std::size_t> out   ( dates.size() );
+
+    for ( auto& d : dates )
+        d = date::random();
+
+    BENCHMARK( "4096 x std::hash<date>" )
+    {
+        for ( std::size_t i {} ; i < dates.size() ; ++i )
+            out[ i ] = std::hash<date> {}( dates[ i ] );
+
+        return out.back();
+    };
+
+    BENCHMARK( "4096 x hash_dates()" )
+    {
+        hash_dates( dates , out );
+
+        return out.back();
+    };
+}
@@ -0,0 +1,623 @@
+#pragma once
+
+#ifndef DATE_BATCH_H
+#define DATE_BATCH_H
+
+#include "date.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <type_traits>
+
+#if defined( __SSSE3__ )
+#include <immintrin.h>
+#endif
+
+namespace project
+{
+
+[[nodiscard]] inline std::size_t parse_dates( const char* first , std::size_t stride , std::span<date> out );
+// Writes "DD/MM/YYYY" records back to back and returns how many were written,
+// stopping at the first date whose year does not fit in 4 digits.
+[[nodiscard]] inline std::size_t format_dates( std::span<const date> dates , char* out );
+inline void add_days( std::span<date> dates , int days );
+inline void add_days( std::span<date> dates , std::span<const int> days );
+inline void diff_days( std::span<const date> x , std::span<const date> y , std::span<std::int32_t> out );
+inline void diff_days( std::span<const date> x , const date& y , std::span<std::int32_t> out );
+inline void week_days( std::span<const date> dates , std::span<date::day> out );
+inline void from_time_t( std::span<const std::time_t> times , std::span<date> out );
+inline void hash_dates( std::span<const date> dates , std::span<std::size_t> out );
+
+namespace detail
+{
+
+#if defined( __SSSE3__ )
+
+// Checks and decodes one "DD/MM/YYYY" record held in the low 10 bytes of each
+// 128-bit lane. Returns the lane's [ day , month , year ] as 16-bit fields and
+// sets the matching bit of 'valid' when separators, digits and ranges hold.
+template< typename V , typename Ops >
+[[nodiscard]] inline V decode_records( V r , unsigned& valid , Ops ops )
+{
+    const V digit_pos  { ops.bytes( -1 , -1 , 0 , -1 , -1 , 0 , -1 , -1 , -1 , -1 , 0 , 0 , 0 , 0 , 0 , 0 ) };
+    const V slash_pos  { ops.bytes( 0 , 0 , -1 , 0 , 0 , -1 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 ) };
+    const V gather     { ops.bytes( 0 , 1 , 3 , 4 , 6 , 7 , 8 , 9 , -1 , -1 , -1 , -1 , -1 , -1 , -1 , -1 ) };
+    const V tens       { ops.bytes( 10 , 1 , 10 , 1 , 10 , 1 , 10 , 1 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 ) };
+
+    V digits   { ops.sub8( r , ops.splat8( '0' ) ) };
+    V digit_ok { ops.and_( ops.eq8( ops.min8( digits , ops.splat8( 9 ) ) , digits ) , digit_pos ) };
+    V slash_ok { ops.and_( ops.eq8( r , ops.splat8( '/' ) ) , slash_pos ) };
+
+    valid = ops.movemask8( ops.or_( digit_ok , slash_ok ) );
+
+    // [ D , M , Y_hi , Y_lo , 0 ... ] -> [ D , M , 100 * Y_hi + Y_lo , ... ]
+    V pairs  { ops.maddubs( ops.shuffle8( digits , gather ) , tens ) };
+    V scaled { ops.mullo16( pairs , ops.words( 1 , 1 , 100 , 0 , 0 , 0 , 0 , 0 ) ) };
+    V fields { ops.add16( scaled , ops.and_( ops.srli_bytes2( pairs ) , ops.words( 0 , 0 , -1 , 0 , 0 , 0 , 0 , 0 ) ) ) };
+
+    V too_low  { ops.gt16( ops.words( 1 , 1 , date::BASE_YEAR , 0 , 0 , 0 , 0 , 0 ) , fields ) };
+    V too_high { ops.gt16( fields , ops.words( 31 , 12 , 9999 , 0 , 0 , 0 , 0 , 0 ) ) };
+
+    valid &= ~ops.movemask8( ops.or_( too_low , too_high ) );
+
+    return fields;
+}
+
+struct sse_ops
+{
+    using V = __m128i;
+
+    static V bytes( char a0 , char a1 , char a2 , char a3 , char a4 , char a5 , char a6 , char a7 ,
+                    char a8 , char a9 , char a10 , char a11 , char a12 , char a13 , char a14 , char a15 )
+    {
+        return _mm_setr_epi8( a0 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13 , a14 , a15 );
+    }
+
+    static V words( short a0 , short a1 , short a2 , short a3 , short a4 , short a5 , short a6 , short a7 )
+    {
+        return _mm_setr_epi16( a0 , a1 , a2 , a3 , a4 , a5 , a6 , a7 );
+    }
+
+    static V splat8( char c )              { return _mm_set1_epi8( c ); }
+    static V sub8( V a , V b )             { return _mm_sub_epi8( a , b ); }
+    static V min8( V a , V b )             { return _mm_min_epu8( a , b ); }
+    static V eq8( V a , V b )              { return _mm_cmpeq_epi8( a , b ); }
+    static V and_( V a , V b )             { return _mm_and_si128( a , b ); }
+    static V or_( V a , V b )              { return _mm_or_si128( a , b ); }
+    static V shuffle8( V a , V idx )       { return _mm_shuffle_epi8( a , idx ); }
+    static V maddubs( V a , V b )          { return _mm_maddubs_epi16( a , b ); }
+    static V mullo16( V a , V b )          { return _mm_mullo_epi16( a , b ); }
+    static V add16( V a , V b )            { return _mm_add_epi16( a , b ); }
+    static V gt16( V a , V b )             { return _mm_cmpgt_epi16( a , b ); }
+    static V srli_bytes2( V a )            { return _mm_srli_si128( a , 2 ); }
+    static unsigned movemask8( V a )       { return unsigned( _mm_movemask_epi8( a ) ); }
+    static V splat16( short c )            { return _mm_set1_epi16( c ); }
+    static V add8( V a , V b )             { return _mm_add_epi8( a , b ); }
+    static V sub16( V a , V b )            { return _mm_sub_epi16( a , b ); }
+    static V mulhi16( V a , V b )          { return _mm_mulhi_epu16( a , b ); }
+    static V slli16_8( V a )               { return _mm_slli_epi16( a , 8 ); }
+};
+
+#if defined( __AVX2__ )
+
+struct avx2_ops
+{
+    using V = __m256i;
+
+    static V bytes( char a0 , char a1 , char a2 , char a3 , char a4 , char a5 , char a6 , char a7 ,
+                    char a8 , char a9 , char a10 , char a11 , char a12 , char a13 , char a14 , char a15 )
+    {
+        return _mm256_broadcastsi128_si256(
+            sse_ops::bytes( a0 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13 , a14 , a15 )
+        );
+    }
+
+    static V words( short a0 , short a1 , short a2 , short a3 , short a4 , short a5 , short a6 , short a7 )
+    {
+        return _mm256_broadcastsi128_si256(
+            sse_ops::words( a0 , a1 , a2 , a3 , a4 , a5 , a6 , a7 )
+        );
+    }
+
+    static V splat8( char c )              { return _mm256_set1_epi8( c ); }
+    static V sub8( V a , V b )             { return _mm256_sub_epi8( a , b ); }
+    static V min8( V a , V b )             { return _mm256_min_epu8( a , b ); }
+    static V eq8( V a , V b )              { return _mm256_cmpeq_epi8( a , b ); }
+    static V and_( V a , V b )             { return _mm256_and_si256( a , b ); }
+    static V or_( V a , V b )              { return _mm256_or_si256( a , b ); }
+    static V shuffle8( V a , V idx )       { return _mm256_shuffle_epi8( a , idx ); }
+    static V maddubs( V a , V b )          { return _mm256_maddubs_epi16( a , b ); }
+    static V mullo16( V a , V b )          { return _mm256_mullo_epi16( a , b ); }
+    static V add16( V a , V b )            { return _mm256_add_epi16( a , b ); }
+    static V gt16( V a , V b )             { return _mm256_cmpgt_epi16( a , b ); }
+    static V srli_bytes2( V a )            { return _mm256_srli_si256( a , 2 ); }
+    static unsigned movemask8( V a )       { return unsigned( _mm256_movemask_epi8( a ) ); }
+    static V splat16( short c )            { return _mm256_set1_epi16( c ); }
+    static V add8( V a , V b )             { return _mm256_add_epi8( a , b ); }
+    static V sub16( V a , V b )            { return _mm256_sub_epi16( a , b ); }
+    static V mulhi16( V a , V b )          { return _mm256_mulhi_epu16( a , b ); }
+    static V slli16_8( V a )               { return _mm256_slli_epi16( a , 8 ); }
+};
+
+#endif
+
+[[nodiscard]] inline bool store_record( const __m128i& fields , date& out )
+{
+    int day   { _mm_extract_epi16( fields , 0 ) };
+    int month { _mm_extract_epi16( fields , 1 ) };
+    int year  { _mm_extract_epi16( fields , 2 ) };
+
+    if ( day > date::n_days( month , year ) )
+        return false;
+
+    out = date { day , month , year };
+
+    return true;
+}
+
+// Renders [ day , month , year / 100 , year % 100 ] 16-bit fields as a
+// "DD/MM/YYYY" record in the low 10 bytes of each 128-bit lane.
+template< typename V , typename Ops >
+[[nodiscard]] inline V encode_records( V fields , Ops ops )
+{
+    const V scatter { ops.bytes( 0 , 1 , -1 , 2 , 3 , -1 , 4 , 5 , 6 , 7 , -1 , -1 , -1 , -1 , -1 , -1 ) };
+    const V slashes { ops.bytes( 0 , 0 , '/' , 0 , 0 , '/' , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 , 0 ) };
+
+    // x * 6554 >> 16 == x / 10 for every x < 100.
+    V tens   { ops.mulhi16( fields , ops.splat16( 6554 ) ) };
+    V ones   { ops.sub16( fields , ops.mullo16( tens , ops.splat16( 10 ) ) ) };
+    V digits { ops.add8( ops.or_( tens , ops.slli16_8( ones ) ) , ops.splat8( '0' ) ) };
+
+    return ops.or_( ops.shuffle8( digits , scatter ) , slashes );
+}
+
+#if defined( __AVX2__ )
+
+// The kernels below read and write dates as three consecutive ints in
+// declaration order: day, month, year.
+static_assert( sizeof( date ) == 3 * sizeof( int ) && std::is_standard_layout_v<date> );
+
+struct civil_v
+{
+    __m256i day;
+    __m256i month;
+    __m256i year;
+};
+
+[[nodiscard]] inline __m256i mulhi_epu32( __m256i a , __m256i b )
+{
+    __m256i even { _mm256_srli_epi64( _mm256_mul_epu32( a , b ) , 32 ) };
+    __m256i odd  { _mm256_mul_epu32( _mm256_srli_epi64( a , 32 ) , _mm256_srli_epi64( b , 32 ) ) };
+
+    return _mm256_blend_epi32( even , odd , 0b10101010 );
+}
+
+[[nodiscard]] inline civil_v load_dates( const date* p )
+{
+    const int*    base { reinterpret_cast<const int*>( p ) };
+    const __m256i index { _mm256_setr_epi32( 0 , 3 , 6 , 9 , 12 , 15 , 18 , 21 ) };
+
+    return {
+        _mm256_i32gather_epi32( base + 0 , index , 4 ) ,
+        _mm256_i32gather_epi32( base + 1 , index , 4 ) ,
+        _mm256_i32gather_epi32( base + 2 , index , 4 )
+    };
+}
+
+inline void store_dates( date* p , const civil_v& c )
+{
+    alignas( 32 ) int day   [ 8 ];
+    alignas( 32 ) int month [ 8 ];
+    alignas( 32 ) int year  [ 8 ];
+
+    _mm256_store_si256( reinterpret_cast<__m256i*>( day )   , c.day );
+    _mm256_store_si256( reinterpret_cast<__m256i*>( month ) , c.month );
+    _mm256_store_si256( reinterpret_cast<__m256i*>( year )  , c.year );
+
+    int* base { reinterpret_cast<int*>( p ) };
+
+    for ( int i {} ; i < 8 ; ++i )
+    {
+        base[ 3 * i + 0 ] = day[ i ];
+        base[ 3 * i + 1 ] = month[ i ];
+        base[ 3 * i + 2 ] = year[ i ];
+    }
+}
+
+// Vector form of date::serial(), using the Neri-Schneider formulas that
+// date::from_serial() inverts.
+[[nodiscard]] inline __m256i serial_v( const civil_v& c )
+{
+    __m256i j      { _mm256_cmpgt_epi32( _mm256_set1_epi32( 3 ) , c.month ) };
+    __m256i year   { _mm256_add_epi32( c.year , j ) };
+    __m256i month  { _mm256_sub_epi32( c.month , _mm256_and_si256( j , _mm256_set1_epi32( -12 ) ) ) };
+    __m256i cent   { _mm256_srli_epi32( mulhi_epu32( year , _mm256_set1_epi32( 0x51EB851F ) ) , 5 ) };
+    __m256i y_days {
+        _mm256_add_epi32(
+            _mm256_sub_epi32( _mm256_srli_epi32( _mm256_mullo_epi32( year , _mm256_set1_epi32( 1461 ) ) , 2 ) , cent ) ,
+            _mm256_srli_epi32( cent , 2 )
+        )
+    };
+    __m256i m_days {
+        _mm256_srli_epi32(
+            _mm256_sub_epi32( _mm256_mullo_epi32( month , _mm256_set1_epi32( 979 ) ) , _mm256_set1_epi32( 2919 ) ) ,
+            5
+        )
+    };
+
+    return _mm256_add_epi32(
+        _mm256_add_epi32( y_days , m_days ) ,
+        _mm256_sub_epi32( c.day , _mm256_set1_epi32( 307 ) )
+    );
+}
+
+// Vector form of date::from_serial(); every division is a multiply-high.
+[[nodiscard]] inline civil_v from_serial_v( __m256i days )
+{
+    __m256i n_1 { _mm256_add_epi32( _mm256_slli_epi32( days , 2 ) , _mm256_set1_epi32( 4 * 306 + 3 ) ) };
+    __m256i c   { _mm256_srli_epi32( mulhi_epu32( n_1 , _mm256_set1_epi32( int( 3853261556u ) ) ) , 17 ) };
+    __m256i n_c { _mm256_srli_epi32( _mm256_sub_epi32( n_1 , _mm256_mullo_epi32( c , _mm256_set1_epi32( 146097 ) ) ) , 2 ) };
+    __m256i z   {
+        mulhi_epu32(
+            _mm256_add_epi32( _mm256_slli_epi32( n_c , 2 ) , _mm256_set1_epi32( 3 ) ) ,
+            _mm256_set1_epi32( 2939745 )
+        )
+    };
+    __m256i n_y { _mm256_sub_epi32( n_c , _mm256_srli_epi32( _mm256_mullo_epi32( z , _mm256_set1_epi32( 1461 ) ) , 2 ) ) };
+    __m256i n_3 { _mm256_add_epi32( _mm256_mullo_epi32( n_y , _mm256_set1_epi32( 2141 ) ) , _mm256_set1_epi32( 197913 ) ) };
+    __m256i j   { _mm256_cmpgt_epi32( n_y , _mm256_set1_epi32( 305 ) ) };
+
+    // ( x * 31345 ) >> 26 == x / 2141 for every x < 65536.
+    __m256i day {
+        _mm256_srli_epi32(
+            _mm256_mullo_epi32( _mm256_and_si256( n_3 , _mm256_set1_epi32( 0xFFFF ) ) , _mm256_set1_epi32( 31345 ) ) ,
+            26
+        )
+    };
+
+    return {
+        _mm256_add_epi32( day , _mm256_set1_epi32( 1 ) ) ,
+        _mm256_add_epi32( _mm256_srli_epi32( n_3 , 16 ) , _mm256_and_si256( j , _mm256_set1_epi32( -12 ) ) ) ,
+        _mm256_sub_epi32( _mm256_add_epi32( _mm256_mullo_epi32( c , _mm256_set1_epi32( 100 ) ) , z ) , j )
+    };
+}
+
+// floor( t / DAY_SECONDS ) for four 64-bit timestamps. The int64 -> double
+// conversion is exact for |t| < 2^51, and within the supported year range
+// the quotient is far enough from the next integer for floor() to be exact.
+[[nodiscard]] inline __m128i days_from_time_v( const std::time_t* p )
+{
+    const __m256d magic { _mm256_set1_pd( 0x0018000000000000 ) };
+
+    __m256i t { _mm256_loadu_si256( reinterpret_cast<const __m256i*>( p ) ) };
+    __m256d x { _mm256_sub_pd( _mm256_castsi256_pd( _mm256_add_epi64( t , _mm256_castpd_si256( magic ) ) ) , magic ) };
+
+    return _mm256_cvttpd_epi32( _mm256_floor_pd( _mm256_div_pd( x , _mm256_set1_pd( date::DAY_SECONDS ) ) ) );
+}
+
+#endif
+
+[[nodiscard]] inline __m128i record_fields( const date& d )
+{
+    assert( d.year() <= 9999 );
+
+    return _mm_setr_epi16(
+        short( d.month_day() ) , short( d.month() ) , short( d.year() / 100 ) , short( d.year() % 100 ) ,
+        0 , 0 , 0 , 0
+    );
+}
+
+#endif
+
+}
+
+std::size_t parse_dates( const char* first , std::size_t stride , std::span<date> out )
+{
+    assert( stride >= 10 );
+
+    std::size_t count { out.size() };
+    std::size_t i     {};
+
+#if defined( __SSSE3__ )
+
+    // Vector loads read 16 bytes per record; the last record's load would run
+    // past its 10 bytes, so it always goes through the scalar path.
+    std::size_t n_vector { count ? count - 1 : 0 };
+
+#if defined( __AVX2__ )
+
+    for ( ; i + 1 < n_vector ; i += 2 )
+    {
+        const char* p { first + i * stride };
+
+        __m256i r {
+            _mm256_inserti128_si256(
+                _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) ) ) ,
+                _mm_loadu_si128( reinterpret_cast<const __m128i*>( p + stride ) ) ,
+                1
+            )
+        };
+
+        unsigned valid;
+        __m256i  fields { detail::decode_records( r , valid , detail::avx2_ops {} ) };
+
+        if ( ( valid & 0x03FF ) != 0x03FF ||
+             !detail::store_record( _mm256_castsi256_si128( fields ) , out[ i ] ) )
+            return i;
+
+        if ( ( valid & 0x03FF0000 ) != 0x03FF0000 ||
+             !detail::store_record( _mm256_extracti128_si256( fields , 1 ) , out[ i + 1 ] ) )
+            return i + 1;
+    }
+
+#endif
+
+    for ( ; i < n_vector ; ++i )
+    {
+        __m128i r { _mm_loadu_si128( reinterpret_cast<const __m128i*>( first + i * stride ) ) };
+
+        unsigned valid;
+        __m128i  fields { detail::decode_records( r , valid , detail::sse_ops {} ) };
+
+        if ( ( valid & 0x03FF ) != 0x03FF || !detail::store_record( fields , out[ i ] ) )
+            return i;
+    }
+
+#endif
+
+    for ( ; i < count ; ++i )
+    {
+        const char* p { first + i * stride };
+
+        if ( date::from_chars( p , p + 10 , out[ i ] ).ec != std::errc {} )
+            return i;
+    }
+
+    return count;
+}
+
+std::size_t format_dates( std::span<const date> dates , char* out )
+{
+    std::size_t count { dates.size() };
+    std::size_t i     {};
+
+#if defined( __SSSE3__ )
+
+    // Vector stores write 16 bytes per record; the last record goes through
+    // the scalar path so that nothing is written past the output buffer.
+    std::size_t n_vector { count ? count - 1 : 0 };
+
+#if defined( __AVX2__ )
+
+    for ( ; i + 1 < n_vector ; i += 2 )
+    {
+        if ( dates[ i ].year() > 9999 || dates[ i + 1 ].year() > 9999 )
+            break;
+
+        __m256i text {
+            detail::encode_records(
+                _mm256_setr_m128i( detail::record_fields( dates[ i ] ) , detail::record_fields( dates[ i + 1 ] ) ) ,
+                detail::avx2_ops {}
+            )
+        };
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 10 * i ) , _mm256_castsi256_si128( text ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 10 * i + 10 ) , _mm256_extracti128_si256( text , 1 ) );
+    }
+
+#endif
+
+    for ( ; i < n_vector ; ++i )
+    {
+        if ( dates[ i ].year() > 9999 )
+            break;
+
+        __m128i text { detail::encode_records( detail::record_fields( dates[ i ] ) , detail::sse_ops {} ) };
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 10 * i ) , text );
+    }
+
+#endif
+
+    for ( ; i < count ; ++i )
+    {
+        if ( dates[ i ].year() > 9999 )
+            return i;
+
+        [[maybe_unused]] auto [ ptr , ec ] = dates[ i ].to_chars( out + 10 * i , out + 10 * i + 10 );
+
+        assert( ec == std::errc {} );
+    }
+
+    return count;
+}
+
+void add_days( std::span<date> dates , int days )
+{
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    const __m256i shift { _mm256_set1_epi32( days ) };
+
+    for ( ; i + 8 <= dates.size() ; i += 8 )
+        detail::store_dates(
+            dates.data() + i ,
+            detail::from_serial_v( _mm256_add_epi32( detail::serial_v( detail::load_dates( dates.data() + i ) ) , shift ) )
+        );
+
+#endif
+
+    for ( ; i < dates.size() ; ++i )
+        dates[ i ] += days;
+}
+
+void add_days( std::span<date> dates , std::span<const int> days )
+{
+    assert( dates.size() == days.size() );
+
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    for ( ; i + 8 <= dates.size() ; i += 8 )
+    {
+        __m256i shift { _mm256_loadu_si256( reinterpret_cast<const __m256i*>( days.data() + i ) ) };
+
+        detail::store_dates(
+            dates.data() + i ,
+            detail::from_serial_v( _mm256_add_epi32( detail::serial_v( detail::load_dates( dates.data() + i ) ) , shift ) )
+        );
+    }
+
+#endif
+
+    for ( ; i < dates.size() ; ++i )
+        dates[ i ] += days[ i ];
+}
+
+void diff_days( std::span<const date> x , std::span<const date> y , std::span<std::int32_t> out )
+{
+    assert( x.size() == y.size() && x.size() == out.size() );
+
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    for ( ; i + 8 <= x.size() ; i += 8 )
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>( out.data() + i ) ,
+            _mm256_sub_epi32(
+                detail::serial_v( detail::load_dates( x.data() + i ) ) ,
+                detail::serial_v( detail::load_dates( y.data() + i ) )
+            )
+        );
+
+#endif
+
+    for ( ; i < x.size() ; ++i )
+        out[ i ] = x[ i ] - y[ i ];
+}
+
+void diff_days( std::span<const date> x , const date& y , std::span<std::int32_t> out )
+{
+    assert( x.size() == out.size() );
+
+    std::size_t i      {};
+    int         serial { y.serial() };
+
+#if defined( __AVX2__ )
+
+    const __m256i reference { _mm256_set1_epi32( serial ) };
+
+    for ( ; i + 8 <= x.size() ; i += 8 )
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>( out.data() + i ) ,
+            _mm256_sub_epi32( detail::serial_v( detail::load_dates( x.data() + i ) ) , reference )
+        );
+
+#endif
+
+    for ( ; i < x.size() ; ++i )
+        out[ i ] = x[ i ].serial() - serial;
+}
+
+void week_days( std::span<const date> dates , std::span<date::day> out )
+{
+    assert( dates.size() == out.size() );
+
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    static_assert( sizeof( date::day ) == sizeof( std::int32_t ) );
+
+    for ( ; i + 8 <= dates.size() ; i += 8 )
+    {
+        // ( serial + 1 ) % 7, with x / 7 == ( x * 0x92492493 ) >> 34 for x < 2^31.
+        __m256i x { _mm256_add_epi32( detail::serial_v( detail::load_dates( dates.data() + i ) ) , _mm256_set1_epi32( 1 ) ) };
+        __m256i q { _mm256_srli_epi32( detail::mulhi_epu32( x , _mm256_set1_epi32( int( 0x92492493u ) ) ) , 2 ) };
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>( out.data() + i ) ,
+            _mm256_sub_epi32( x , _mm256_mullo_epi32( q , _mm256_set1_epi32( 7 ) ) )
+        );
+    }
+
+#endif
+
+    for ( ; i < dates.size() ; ++i )
+        out[ i ] = dates[ i ].week_day();
+}
+
+void from_time_t( std::span<const std::time_t> times , std::span<date> out )
+{
+    assert( times.size() == out.size() );
+
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    if constexpr ( sizeof( std::time_t ) == sizeof( std::int64_t ) )
+        for ( ; i + 8 <= times.size() ; i += 8 )
+        {
+            __m256i days {
+                _mm256_setr_m128i(
+                    detail::days_from_time_v( times.data() + i ) ,
+                    detail::days_from_time_v( times.data() + i + 4 )
+                )
+            };
+
+            detail::store_dates(
+                out.data() + i ,
+                detail::from_serial_v( _mm256_add_epi32( days , _mm256_set1_epi32( date::EPOCH_SERIAL ) ) )
+            );
+        }
+
+#endif
+
+    for ( ; i < times.size() ; ++i )
+        out[ i ] = date { times[ i ] };
+}
+
+void hash_dates( std::span<const date> dates , std::span<std::size_t> out )
+{
+    assert( dates.size() == out.size() );
+
+    std::size_t i {};
+
+#if defined( __AVX2__ )
+
+    if constexpr ( sizeof( std::size_t ) == sizeof( std::uint64_t ) )
+        for ( ; i + 8 <= dates.size() ; i += 8 )
+        {
+            // hash_serial(), eight lanes at a time.
+            __m256i h { detail::serial_v( detail::load_dates( dates.data() + i ) ) };
+
+            h = _mm256_xor_si256( h , _mm256_srli_epi32( h , 16 ) );
+            h = _mm256_mullo_epi32( h , _mm256_set1_epi32( int( 0x85EBCA6Bu ) ) );
+            h = _mm256_xor_si256( h , _mm256_srli_epi32( h , 13 ) );
+            h = _mm256_mullo_epi32( h , _mm256_set1_epi32( int( 0xC2B2AE35u ) ) );
+            h = _mm256_xor_si256( h , _mm256_srli_epi32( h , 16 ) );
+
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>( out.data() + i ) ,
+                _mm256_cvtepu32_epi64( _mm256_castsi256_si128( h ) )
+            );
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>( out.data() + i + 4 ) ,
+                _mm256_cvtepu32_epi64( _mm256_extracti128_si256( h , 1 ) )
+            );
+        }
+
+#endif
+
+    for ( ; i < dates.size() ; ++i )
+        out[ i ] = std::hash<date> {}( dates[ i ] );
+}
+
+}
+
+#endif
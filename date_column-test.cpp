@@ -0,0 +1,83 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+#include "date_column.hpp"
+#include <algorithm>
+#include <ranges>
+
+TEST_CASE( "date_column::push_back( const date& )" )
+{
+    using namespace project;
+
+    date_column c;
+
+    c.reserve( 3 );
+    c.push_back( date { 1  , 1 , 2000 } );
+    c.push_back( date { 29 , 2 , 2000 } );
+    c.push_back( date { 24 , 8 , 2022 } );
+
+    REQUIRE( c.size() == 3 );
+    REQUIRE( !c.empty() );
+    REQUIRE( c[ 0 ] == date { 1  , 1 , 2000 } );
+    REQUIRE( c[ 1 ] == date { 29 , 2 , 2000 } );
+    REQUIRE( c[ 2 ] == date { 24 , 8 , 2022 } );
+    REQUIRE( c.serials()[ 0 ] == date { 1 , 1 , 2000 }.serial() );
+
+    c.clear();
+
+    REQUIRE( c.empty() );
+}
+
+TEST_CASE( "date_column iteration" )
+{
+    using namespace project;
+
+    std::vector<date> dates { { 3 , 1 , 2000 } , { 1 , 1 , 2000 } , { 2 , 1 , 2000 } };
+    date_column       c     { dates };
+
+    STATIC_REQUIRE( std::random_access_iterator<date_column::const_iterator> );
+    STATIC_REQUIRE( std::ranges::random_access_range<date_column> );
+
+    REQUIRE( std::equal( c.begin() , c.end() , dates.begin() , dates.end() ) );
+    REQUIRE( c.end() - c.begin() == 3 );
+    REQUIRE( c.begin()[ 2 ] == date { 2 , 1 , 2000 } );
+    REQUIRE( *std::ranges::min_element( c ) == date { 1 , 1 , 2000 } );
+}
+
+TEST_CASE( "date_column& date_column::shift( int )" )
+{
+    using namespace project;
+
+    date_column c { std::vector<date> { { 31 , 12 , 1999 } , { 28 , 2 , 2000 } } };
+
+    c.shift( 1 );
+
+    REQUIRE( c[ 0 ] == date { 1  , 1 , 2000 } );
+    REQUIRE( c[ 1 ] == date { 29 , 2 , 2000 } );
+
+    c.shift( -366 );
+
+    REQUIRE( c[ 0 ] == date { 31 , 12 , 1998 } );
+    REQUIRE( c[ 1 ] == date { 28 , 2  , 1999 } );
+}
+
+TEST_CASE( "std::vector<int> date_column::diff( ... ) const" )
+{
+    using namespace project;
+
+    date_column x { std::vector<date> { { 11 , 4 , 2022 } , { 1  , 10 , 2001 } } };
+    date_column y { std::vector<date> { { 1 , 12 , 2000 } , { 23 , 5  , 2045 } } };
+
+    REQUIRE( x.diff( y ) == std::vector<int> { 7801 , -15940 } );
+    REQUIRE( x.diff( date { 1 , 10 , 2001 } ) == std::vector<int> { 7497 , 0 } );
+}
+
+TEST_CASE( "std::vector<date::day> date_column::week_days() const" )
+{
+    using namespace project;
+
+    date_column c { std::vector<date> { { 11 , 2 , 1978 } , { 9 , 6 , 2022 } , { 4 , 11 , 2001 } } };
+
+    REQUIRE( c.week_days() == std::vector<date::day> {
+        date::day::saturday , date::day::thursday , date::day::sunday
+    } );
+}
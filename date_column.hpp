@@ -0,0 +1,185 @@
+#pragma once
+
+#ifndef DATE_COLUMN_H
+#define DATE_COLUMN_H
+
+#include "date.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace project
+{
+
+class date_column
+{
+
+public:
+
+    using value_type = date;
+    using size_type  = std::size_t;
+    using rep        = serial_date::rep;
+
+    class const_iterator;
+
+    date_column() = default;
+    inline explicit date_column( std::span<const date> );
+
+    inline void reserve( size_type );
+    inline void push_back( const date& );
+    inline void clear();
+
+    [[nodiscard]] inline size_type size() const;
+    [[nodiscard]] inline bool empty() const;
+    [[nodiscard]] inline date operator[]( size_type ) const;
+    [[nodiscard]] inline std::span<const rep> serials() const;
+    [[nodiscard]] inline const_iterator begin() const;
+    [[nodiscard]] inline const_iterator end() const;
+
+    inline date_column& shift( int days );
+    [[nodiscard]] inline std::vector<int> diff( const date_column& ) const;
+    [[nodiscard]] inline std::vector<int> diff( const date& ) const;
+    [[nodiscard]] inline std::vector<date::day> week_days() const;
+
+private:
+
+    std::vector<rep> m_serials;
+};
+
+class date_column::const_iterator
+{
+
+public:
+
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = date;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = date;
+
+    const_iterator() = default;
+    explicit const_iterator( const rep* p ) : m_p { p } {}
+
+    [[nodiscard]] date operator*() const { return date::from_serial( *m_p ); }
+    [[nodiscard]] date operator[]( difference_type n ) const { return date::from_serial( m_p[ n ] ); }
+
+    const_iterator& operator++() { ++m_p; return *this; }
+    const_iterator  operator++( int ) { const_iterator curr { *this }; ++m_p; return curr; }
+    const_iterator& operator--() { --m_p; return *this; }
+    const_iterator  operator--( int ) { const_iterator curr { *this }; --m_p; return curr; }
+    const_iterator& operator+=( difference_type n ) { m_p += n; return *this; }
+    const_iterator& operator-=( difference_type n ) { m_p -= n; return *this; }
+
+    [[nodiscard]] friend const_iterator operator+( const_iterator it , difference_type n ) { return it += n; }
+    [[nodiscard]] friend const_iterator operator+( difference_type n , const_iterator it ) { return it += n; }
+    [[nodiscard]] friend const_iterator operator-( const_iterator it , difference_type n ) { return it -= n; }
+    [[nodiscard]] friend difference_type operator-( const_iterator x , const_iterator y ) { return x.m_p - y.m_p; }
+    [[nodiscard]] friend bool operator==( const_iterator x , const_iterator y ) = default;
+    [[nodiscard]] friend auto operator<=>( const_iterator x , const_iterator y ) = default;
+
+private:
+
+    const rep* m_p {};
+};
+
+date_column::date_column( std::span<const date> dates )
+{
+    m_serials.reserve( dates.size() );
+
+    for ( const auto& d : dates )
+        m_serials.push_back( d.serial() );
+}
+
+void date_column::reserve( size_type n )
+{
+    m_serials.reserve( n );
+}
+
+void date_column::push_back( const date& d )
+{
+    m_serials.push_back( d.serial() );
+}
+
+void date_column::clear()
+{
+    m_serials.clear();
+}
+
+date_column::size_type date_column::size() const
+{
+    return m_serials.size();
+}
+
+bool date_column::empty() const
+{
+    return m_serials.empty();
+}
+
+date date_column::operator[]( size_type i ) const
+{
+    return date::from_serial( m_serials[ i ] );
+}
+
+std::span<const date_column::rep> date_column::serials() const
+{
+    return m_serials;
+}
+
+date_column::const_iterator date_column::begin() const
+{
+    return const_iterator { m_serials.data() };
+}
+
+date_column::const_iterator date_column::end() const
+{
+    return const_iterator { m_serials.data() + m_serials.size() };
+}
+
+date_column& date_column::shift( int days )
+{
+    for ( auto& s : m_serials )
+        s += days;
+
+    return *this;
+}
+
+std::vector<int> date_column::diff( const date_column& other ) const
+{
+    assert( size() == other.size() );
+
+    std::vector<int> result ( size() );
+
+    for ( size_type i {} ; i < result.size() ; ++i )
+        result[ i ] = m_serials[ i ] - other.m_serials[ i ];
+
+    return result;
+}
+
+std::vector<int> date_column::diff( const date& reference ) const
+{
+    std::vector<int> result ( size() );
+
+    rep base { reference.serial() };
+
+    for ( size_type i {} ; i < result.size() ; ++i )
+        result[ i ] = m_serials[ i ] - base;
+
+    return result;
+}
+
+std::vector<date::day> date_column::week_days() const
+{
+    std::vector<date::day> result ( size() );
+
+    for ( size_type i {} ; i < result.size() ; ++i )
+        result[ i ] = date::day( ( m_serials[ i ] + 1 ) % 7 );
+
+    return result;
+}
+
+}
+
+#endif
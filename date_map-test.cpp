@@ -0,0 +1,112 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "date_map.hpp"
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE( "V& date_map<V>::operator[]( const date& )" )
+{
+    using namespace project;
+
+    date_map<int> m;
+
+    REQUIRE( m.empty() );
+
+    ++m[ date { 9  , 6 , 2022 } ];
+    ++m[ date { 9  , 6 , 2022 } ];
+    ++m[ date { 1  , 1 , 2022 } ];
+    ++m[ date { 31 , 12 , 2023 } ];
+    ++m[ date { 1  , 1 , 1900 } ];
+
+    REQUIRE( m.size() == 4 );
+    REQUIRE( m.at( date { 9 , 6 , 2022 } ) == 2 );
+    REQUIRE( m.at( date { 1 , 1 , 2022 } ) == 1 );
+    REQUIRE( m.at( date { 31 , 12 , 2023 } ) == 1 );
+    REQUIRE( m.at( date { 1 , 1 , 1900 } ) == 1 );
+    REQUIRE( !m.contains( date { 10 , 6 , 2022 } ) );
+    REQUIRE( !m.contains( date { 1 , 1 , 2100 } ) );
+    REQUIRE( m.find( date { 10 , 6 , 2022 } ) == nullptr );
+    REQUIRE_THROWS_AS( m.at( date { 10 , 6 , 2022 } ) , std::out_of_range );
+}
+
+TEST_CASE( "bool date_map<V>::erase( const date& )" )
+{
+    using namespace project;
+
+    date_map<int> m { date { 1 , 1 , 2022 } , date { 31 , 12 , 2022 } };
+
+    REQUIRE( m.empty() );
+
+    m[ date { 9 , 6 , 2022 } ] = 5;
+
+    REQUIRE( m.erase( date { 9 , 6 , 2022 } ) );
+    REQUIRE( !m.erase( date { 9 , 6 , 2022 } ) );
+    REQUIRE( !m.erase( date { 9 , 6 , 1999 } ) );
+    REQUIRE( m.empty() );
+    REQUIRE( m[ date { 9 , 6 , 2022 } ] == 0 );
+
+    m.clear();
+
+    REQUIRE( m.empty() );
+    REQUIRE( !m.contains( date { 9 , 6 , 2022 } ) );
+}
+
+TEST_CASE( "date_map<V> matches std::map<date , V>" )
+{
+    using namespace project;
+
+    date_map<long>        m;
+    std::map<date , long> expected;
+    std::mt19937          gen  { 7 };
+    std::uniform_int_distribution<> dist { -5000 , 5000 };
+
+    for ( int i {} ; i < 20000 ; ++i )
+    {
+        date d { date { 1 , 1 , 2000 } + dist( gen ) };
+
+        m[ d ]        += i;
+        expected[ d ] += i;
+    }
+
+    REQUIRE( m.size() == expected.size() );
+
+    std::vector<std::pair<date , long>> entries;
+
+    m.for_each( [ & ] ( const date& d , long v ) { entries.emplace_back( d , v ); } );
+
+    auto same = [] ( const auto& x , const auto& y ) { return x.first == y.first && x.second == y.second; };
+
+    REQUIRE( std::equal( entries.begin() , entries.end() , expected.begin() , expected.end() , same ) );
+}
+
+TEST_CASE( "date_map<V> benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::vector<date> rows ( 1'000'000 );
+
+    for ( auto& d : rows )
+        d = date::random();
+
+    BENCHMARK( "group by 1M dates, std::unordered_map<date , long>" )
+    {
+        std::unordered_map<date , long> counts;
+
+        for ( const auto& d : rows )
+            ++counts[ d ];
+
+        return counts.size();
+    };
+
+    BENCHMARK( "group by 1M dates, date_map<long>" )
+    {
+        date_map<long> counts;
+
+        for ( const auto& d : rows )
+            ++counts[ d ];
+
+        return counts.size();
+    };
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#ifndef DATE_MAP_H
+#define DATE_MAP_H
+
+#include "date.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace project
+{
+
+// Map from date to V stored as one contiguous slot per day, indexed by
+// serial day number minus a base. Lookups are a subtraction and a bounds
+// check; the slot array grows geometrically towards whichever side a new
+// key falls on.
+template< typename V >
+class date_map
+{
+
+public:
+
+    using key_type    = date;
+    using mapped_type = V;
+    using size_type   = std::size_t;
+    using rep         = serial_date::rep;
+
+    date_map() = default;
+    date_map( const date& first , const date& last );
+
+    [[nodiscard]] size_type size() const;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] bool contains( const date& ) const;
+    [[nodiscard]] V* find( const date& );
+    [[nodiscard]] const V* find( const date& ) const;
+    [[nodiscard]] V& at( const date& );
+    [[nodiscard]] const V& at( const date& ) const;
+
+    V& operator[]( const date& );
+    bool erase( const date& );
+    void clear();
+
+    // Calls f( date , V& ) for every entry in date order.
+    template< typename F >
+    void for_each( F f );
+    template< typename F >
+    void for_each( F f ) const;
+
+private:
+
+    [[nodiscard]] std::size_t slot( rep serial ) const;
+    void grow( rep serial );
+
+    rep                        m_base {};
+    std::vector<V>             m_values;
+    std::vector<unsigned char> m_used;
+    size_type                  m_size {};
+};
+
+// Reserves slots for [ first , last ] up front so that filling that range
+// never reallocates.
+template< typename V >
+date_map<V>::date_map( const date& first , const date& last )
+    :   m_base   { first.serial() }
+    ,   m_values ( std::size_t( std::max( last - first + 1 , 0 ) ) )
+    ,   m_used   ( m_values.size() )
+{}
+
+template< typename V >
+typename date_map<V>::size_type date_map<V>::size() const
+{
+    return m_size;
+}
+
+template< typename V >
+bool date_map<V>::empty() const
+{
+    return m_size == 0;
+}
+
+template< typename V >
+bool date_map<V>::contains( const date& d ) const
+{
+    return find( d ) != nullptr;
+}
+
+template< typename V >
+V* date_map<V>::find( const date& d )
+{
+    return const_cast<V*>( std::as_const( *this ).find( d ) );
+}
+
+template< typename V >
+const V* date_map<V>::find( const date& d ) const
+{
+    std::size_t i { slot( d.serial() ) };
+
+    return i < m_used.size() && m_used[ i ] ? &m_values[ i ] : nullptr;
+}
+
+template< typename V >
+V& date_map<V>::at( const date& d )
+{
+    return const_cast<V&>( std::as_const( *this ).at( d ) );
+}
+
+template< typename V >
+const V& date_map<V>::at( const date& d ) const
+{
+    const V* p { find( d ) };
+
+    if ( !p )
+        throw std::out_of_range { "date_map::at: date not present" };
+
+    return *p;
+}
+
+template< typename V >
+V& date_map<V>::operator[]( const date& d )
+{
+    rep         serial { d.serial() };
+    std::size_t i      { slot( serial ) };
+
+    if ( i >= m_used.size() )
+    {
+        grow( serial );
+        i = slot( serial );
+    }
+
+    if ( !m_used[ i ] )
+    {
+        m_used[ i ] = 1;
+        ++m_size;
+    }
+
+    return m_values[ i ];
+}
+
+template< typename V >
+bool date_map<V>::erase( const date& d )
+{
+    std::size_t i { slot( d.serial() ) };
+
+    if ( i >= m_used.size() || !m_used[ i ] )
+        return false;
+
+    m_values[ i ] = V {};
+    m_used[ i ]   = 0;
+    --m_size;
+
+    return true;
+}
+
+template< typename V >
+void date_map<V>::clear()
+{
+    m_values.clear();
+    m_used.clear();
+    m_size = 0;
+}
+
+template< typename V >
+template< typename F >
+void date_map<V>::for_each( F f )
+{
+    for ( std::size_t i {} ; i < m_used.size() ; ++i )
+        if ( m_used[ i ] )
+            f( date::from_serial( m_base + rep( i ) ) , m_values[ i ] );
+}
+
+template< typename V >
+template< typename F >
+void date_map<V>::for_each( F f ) const
+{
+    for ( std::size_t i {} ; i < m_used.size() ; ++i )
+        if ( m_used[ i ] )
+            f( date::from_serial( m_base + rep( i ) ) , m_values[ i ] );
+}
+
+// Keys below the base wrap to huge unsigned offsets, so one comparison
+// against the slot count rejects both sides.
+template< typename V >
+std::size_t date_map<V>::slot( rep serial ) const
+{
+    return std::size_t( std::make_unsigned_t<rep>( serial - m_base ) );
+}
+
+template< typename V >
+void date_map<V>::grow( rep serial )
+{
+    if ( m_values.empty() )
+    {
+        m_base = serial;
+        m_values.resize( 1 );
+        m_used.resize( 1 );
+
+        return;
+    }
+
+    rep         old_last { m_base + rep( m_values.size() ) };
+    rep         first    { std::min( m_base , serial ) };
+    rep         last     { std::max( old_last , serial + 1 ) };
+    std::size_t n_slots  { std::max( std::size_t( last - first ) , 2 * m_values.size() ) };
+
+    if ( serial < m_base )
+        first = last - rep( n_slots );
+
+    std::vector<V>             values ( n_slots );
+    std::vector<unsigned char> used   ( n_slots );
+    std::size_t                offset ( m_base - first );
+
+    std::move( m_values.begin() , m_values.end() , values.begin() + offset );
+    std::copy( m_used.begin() , m_used.end() , used.begin() + offset );
+
+    m_base = first;
+    m_values.swap( values );
+    m_used.swap( used );
+}
+
+}
+
+#endif
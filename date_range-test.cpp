@@ -0,0 +1,90 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "date_range.hpp"
+#include <algorithm>
+#include <vector>
+
+TEST_CASE( "date_range is a random access view" )
+{
+    using namespace project;
+
+    STATIC_REQUIRE( std::random_access_iterator<date_range::iterator> );
+    STATIC_REQUIRE( std::ranges::random_access_range<date_range> );
+    STATIC_REQUIRE( std::ranges::sized_range<date_range> );
+    STATIC_REQUIRE( std::ranges::view<date_range> );
+    STATIC_REQUIRE( std::ranges::borrowed_range<date_range> );
+    STATIC_REQUIRE( date_range { date { 1 , 1 , 2000 } , date { 1 , 1 , 2001 } }.size() == 366 );
+    STATIC_REQUIRE( date_range { date { 1 , 1 , 2000 } , date { 1 , 1 , 2001 } }[ 59 ] == date { 29 , 2 , 2000 } );
+}
+
+TEST_CASE( "date_range::date_range( const date& , const date& , int )" )
+{
+    using namespace project;
+
+    for ( int step : { 1 , 2 , 7 , 30 , 400 , -1 , -3 , -31 } )
+    {
+        date first { 15 , 11 , 1999 };
+        date last  { step > 0 ? date { 3 , 3 , 2002 } : date { 20 , 2 , 1997 } };
+
+        std::vector<date> expected;
+
+        for ( date d { first } ; step > 0 ? d < last : d > last ; d += step )
+            expected.push_back( d );
+
+        date_range r { first , last , step };
+
+        REQUIRE( r.size() == expected.size() );
+        REQUIRE( std::ranges::equal( r , expected ) );
+        REQUIRE( std::ranges::equal( r | std::views::reverse , expected | std::views::reverse ) );
+        REQUIRE( r.back() == expected.back() );
+        REQUIRE( r[ r.size() / 2 ] == expected[ expected.size() / 2 ] );
+        REQUIRE( r.end() - r.begin() == std::ptrdiff_t( expected.size() ) );
+    }
+
+    REQUIRE( date_range { date { 1 , 1 , 2000 } , date { 1 , 1 , 2000 } }.empty() );
+    REQUIRE( date_range { date { 2 , 1 , 2000 } , date { 1 , 1 , 2000 } }.empty() );
+    REQUIRE( date_range { date { 1 , 1 , 2000 } , date { 2 , 1 , 2000 } , -1 }.empty() );
+}
+
+TEST_CASE( "date_range with std::ranges algorithms" )
+{
+    using namespace project;
+
+    date_range year { date { 1 , 1 , 2022 } , date { 1 , 1 , 2023 } };
+
+    auto is_sunday = [] ( const date& d ) { return d.week_day() == date::day::sunday; };
+
+    REQUIRE( std::ranges::count_if( year , is_sunday ) == 52 );
+    REQUIRE( *std::ranges::find_if( year , is_sunday ) == date { 2 , 1 , 2022 } );
+    REQUIRE( std::ranges::distance( year | std::views::filter( is_sunday ) ) == 52 );
+    REQUIRE( *std::ranges::lower_bound( year , date { 9 , 6 , 2022 } ) == date { 9 , 6 , 2022 } );
+}
+
+TEST_CASE( "date_range benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    date first { 1 , 1 , 1940 };
+    date last  { 1 , 1 , 2020 };
+
+    BENCHMARK( "80 years, for ( date d ; d < last ; ++d )" )
+    {
+        int sum {};
+
+        for ( date d { first } ; d < last ; ++d )
+            sum += d.month_day();
+
+        return sum;
+    };
+
+    BENCHMARK( "80 years, for ( date d : date_range )" )
+    {
+        int sum {};
+
+        for ( date d : date_range { first , last } )
+            sum += d.month_day();
+
+        return sum;
+    };
+}
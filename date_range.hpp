@@ -0,0 +1,116 @@
+#pragma once
+
+#ifndef DATE_RANGE_H
+#define DATE_RANGE_H
+
+#include "date.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+namespace project
+{
+
+// The dates first , first + step , first + 2 * step , ... that lie in
+// [ first , last ), or in ( last , first ] for a negative step. Iteration
+// never allocates; size() and iterator arithmetic are O( 1 ).
+class date_range : public std::ranges::view_interface<date_range>
+{
+
+public:
+
+    class iterator;
+
+    constexpr date_range() = default;
+    constexpr date_range( const date& first , const date& last , int step = 1 );
+
+    [[nodiscard]] constexpr iterator begin() const;
+    [[nodiscard]] constexpr iterator end() const;
+    [[nodiscard]] constexpr std::size_t size() const;
+    [[nodiscard]] constexpr int step() const;
+
+private:
+
+    date        m_first;
+    int         m_step { 1 };
+    std::size_t m_size {};
+};
+
+class date_range::iterator
+{
+
+public:
+
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = date;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = date;
+
+    constexpr iterator() = default;
+    constexpr iterator( const date& d , int step , difference_type index ) : m_date { d } , m_step { step } , m_index { index } {}
+
+    [[nodiscard]] constexpr date operator*() const { return m_date; }
+    [[nodiscard]] constexpr date operator[]( difference_type n ) const { return m_date + int( n * m_step ); }
+
+    constexpr iterator& operator++() { m_date += m_step; ++m_index; return *this; }
+    constexpr iterator  operator++( int ) { iterator curr { *this }; operator++(); return curr; }
+    constexpr iterator& operator--() { m_date -= m_step; --m_index; return *this; }
+    constexpr iterator  operator--( int ) { iterator curr { *this }; operator--(); return curr; }
+    constexpr iterator& operator+=( difference_type n ) { m_date += int( n * m_step ); m_index += n; return *this; }
+    constexpr iterator& operator-=( difference_type n ) { return *this += -n; }
+
+    [[nodiscard]] friend constexpr iterator operator+( iterator it , difference_type n ) { return it += n; }
+    [[nodiscard]] friend constexpr iterator operator+( difference_type n , iterator it ) { return it += n; }
+    [[nodiscard]] friend constexpr iterator operator-( iterator it , difference_type n ) { return it -= n; }
+    [[nodiscard]] friend constexpr difference_type operator-( const iterator& x , const iterator& y ) { return x.m_index - y.m_index; }
+    [[nodiscard]] friend constexpr bool operator==( const iterator& x , const iterator& y ) { return x.m_index == y.m_index; }
+    [[nodiscard]] friend constexpr auto operator<=>( const iterator& x , const iterator& y ) { return x.m_index <=> y.m_index; }
+
+private:
+
+    date            m_date;
+    int             m_step { 1 };
+    difference_type m_index {};
+};
+
+constexpr date_range::date_range( const date& first , const date& last , int step )
+    :   m_first { first }
+    ,   m_step  { step }
+{
+    assert( step != 0 );
+
+    int span { step > 0 ? last - first : first - last };
+    int n    { step > 0 ? step : -step };
+
+    m_size = span > 0 ? std::size_t( ( span + n - 1 ) / n ) : 0;
+}
+
+constexpr date_range::iterator date_range::begin() const
+{
+    return iterator { m_first , m_step , 0 };
+}
+
+constexpr date_range::iterator date_range::end() const
+{
+    return iterator { m_first + int( m_size ) * m_step , m_step , iterator::difference_type( m_size ) };
+}
+
+constexpr std::size_t date_range::size() const
+{
+    return m_size;
+}
+
+constexpr int date_range::step() const
+{
+    return m_step;
+}
+
+}
+
+template<>
+inline constexpr bool std::ranges::enable_borrowed_range<project::date_range> = true;
+
+#endif
@@ -0,0 +1,138 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "date_series.hpp"
+#include <numeric>
+#include <vector>
+
+TEST_CASE( "date_series<T> lookup" )
+{
+    using namespace project;
+
+    date_series<int> s { date { 30 , 12 , 1999 } , 5 };
+
+    for ( int i {} ; i < 5 ; ++i )
+        s[ date { 30 , 12 , 1999 } + i ] = i;
+
+    REQUIRE( s.size() == 5 );
+    REQUIRE( s.start() == date { 30 , 12 , 1999 } );
+    REQUIRE( s.last() == date { 3 , 1 , 2000 } );
+    REQUIRE( s.date_at( 2 ) == date { 1 , 1 , 2000 } );
+    REQUIRE( s[ date { 1 , 1 , 2000 } ] == 2 );
+    REQUIRE( s.at( date { 3 , 1 , 2000 } ) == 4 );
+    REQUIRE( !s.contains( date { 29 , 12 , 1999 } ) );
+    REQUIRE( !s.contains( date { 4 , 1 , 2000 } ) );
+    REQUIRE_THROWS_AS( s.at( date { 4 , 1 , 2000 } ) , std::out_of_range );
+}
+
+TEST_CASE( "std::span<T> date_series<T>::slice( const date& , const date& )" )
+{
+    using namespace project;
+
+    std::vector<int> values ( 10 );
+
+    std::iota( values.begin() , values.end() , 0 );
+
+    date_series<int> s { date { 1 , 1 , 2000 } , values };
+
+    auto mid = s.slice( date { 3 , 1 , 2000 } , date { 6 , 1 , 2000 } );
+
+    REQUIRE( mid.size() == 3 );
+    REQUIRE( mid[ 0 ] == 2 );
+    REQUIRE( mid[ 2 ] == 4 );
+    REQUIRE( s.slice( date { 1 , 1 , 1999 } , date { 3 , 1 , 2000 } ).size() == 2 );
+    REQUIRE( s.slice( date { 8 , 1 , 2000 } , date { 1 , 1 , 2001 } ).size() == 3 );
+    REQUIRE( s.slice( date { 6 , 1 , 2000 } , date { 3 , 1 , 2000 } ).empty() );
+    REQUIRE( s.slice( date { 1 , 1 , 2001 } , date { 2 , 1 , 2001 } ).empty() );
+
+    mid[ 0 ] = 42;
+
+    REQUIRE( s[ date { 3 , 1 , 2000 } ] == 42 );
+}
+
+TEST_CASE( "date_series<T> rolling aggregates" )
+{
+    using namespace project;
+
+    date_series<int> s { date { 1 , 1 , 2000 } , std::vector<int> { 3 , 1 , 4 , 1 , 5 , 9 , 2 , 6 } };
+
+    auto sum  = s.rolling_sum( 3 );
+    auto mean = s.rolling_mean( 3 );
+    auto min  = s.rolling_min( 3 );
+    auto max  = s.rolling_max( 3 );
+
+    REQUIRE( sum.start() == date { 3 , 1 , 2000 } );
+    REQUIRE( std::ranges::equal( sum.values() , std::vector<int> { 8 , 6 , 10 , 15 , 16 , 17 } ) );
+    REQUIRE( mean[ date { 8 , 1 , 2000 } ] == Approx( 17 / 3.0 ) );
+    REQUIRE( std::ranges::equal( min.values() , std::vector<int> { 1 , 1 , 1 , 1 , 2 , 2 } ) );
+    REQUIRE( std::ranges::equal( max.values() , std::vector<int> { 4 , 4 , 5 , 9 , 9 , 9 } ) );
+    REQUIRE( s.rolling_sum( 1 ).values().size() == 8 );
+    REQUIRE( s.rolling_sum( 9 ).empty() );
+}
+
+TEST_CASE( "date_series<T>::resample( period , F )" )
+{
+    using namespace project;
+
+    // Wednesday 29/12/1999 to Tuesday 29/02/2000, one unit per day.
+    date_series<int> s { date { 29 , 12 , 1999 } , 63 , 1 };
+
+    auto sum = [] ( std::span<const int> v ) { return std::accumulate( v.begin() , v.end() , 0 ); };
+
+    auto weeks  = s.resample( date_series<int>::period::week  , sum );
+    auto months = s.resample( date_series<int>::period::month , sum );
+    auto years  = s.resample( date_series<int>::period::year  , sum );
+
+    REQUIRE( weeks.size() == 10 );
+    REQUIRE( weeks.front().first == date { 27 , 12 , 1999 } );
+    REQUIRE( weeks.front().first.week_day() == date::day::monday );
+    REQUIRE( weeks.front().second == 5 );
+    REQUIRE( weeks[ 1 ].first == date { 3 , 1 , 2000 } );
+    REQUIRE( weeks[ 1 ].second == 7 );
+    REQUIRE( weeks.back().second == 2 );
+
+    REQUIRE( months.size() == 3 );
+    REQUIRE( months[ 0 ] == std::pair { date { 1 , 12 , 1999 } , 3 } );
+    REQUIRE( months[ 1 ] == std::pair { date { 1 , 1  , 2000 } , 31 } );
+    REQUIRE( months[ 2 ] == std::pair { date { 1 , 2  , 2000 } , 29 } );
+
+    REQUIRE( years.size() == 2 );
+    REQUIRE( years[ 0 ] == std::pair { date { 1 , 1 , 1999 } , 3 } );
+    REQUIRE( years[ 1 ] == std::pair { date { 1 , 1 , 2000 } , 60 } );
+}
+
+TEST_CASE( "date_series<T> benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    date_series<double> s { date { 1 , 1 , 1940 } , 365 * 82 , 1.0 };
+    std::vector<date>   queries ( 4096 );
+
+    for ( auto& d : queries )
+        d = date::random();
+
+    BENCHMARK( "4096 x lookup via operator-( const date& , const date& )" )
+    {
+        double sum {};
+
+        for ( const auto& d : queries )
+            sum += s.values()[ std::size_t( d - s.start() ) ];
+
+        return sum;
+    };
+
+    BENCHMARK( "4096 x date_series<double>::operator[]" )
+    {
+        double sum {};
+
+        for ( const auto& d : queries )
+            sum += s[ d ];
+
+        return sum;
+    };
+
+    BENCHMARK( "rolling_mean( 30 ) over 80 years" )
+    {
+        return s.rolling_mean( 30 ).size();
+    };
+}
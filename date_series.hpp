@@ -0,0 +1,340 @@
+#pragma once
+
+#ifndef DATE_SERIES_H
+#define DATE_SERIES_H
+
+#include "date.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace project
+{
+
+// One value per calendar day from start() onwards. A date's slot is its
+// serial day number minus the start's, so lookups and slicing never go
+// through operator-( const date& , const date& ).
+template< typename T >
+class date_series
+{
+
+public:
+
+    using value_type = T;
+    using size_type  = std::size_t;
+    using rep        = serial_date::rep;
+
+    enum class period
+    {
+        week  ,
+        month ,
+        year
+    };
+
+    date_series() = default;
+    date_series( const date& start , size_type n , const T& value = T {} );
+    date_series( const date& start , std::vector<T> values );
+
+    [[nodiscard]] date start() const;
+    [[nodiscard]] date last() const;
+    [[nodiscard]] size_type size() const;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] bool contains( const date& ) const;
+    [[nodiscard]] date date_at( size_type i ) const;
+    [[nodiscard]] std::span<T> values();
+    [[nodiscard]] std::span<const T> values() const;
+
+    [[nodiscard]] T& operator[]( const date& );
+    [[nodiscard]] const T& operator[]( const date& ) const;
+    [[nodiscard]] T& at( const date& );
+    [[nodiscard]] const T& at( const date& ) const;
+
+    // Values for the days in [ first , last ), clamped to the series.
+    [[nodiscard]] std::span<T> slice( const date& first , const date& last );
+    [[nodiscard]] std::span<const T> slice( const date& first , const date& last ) const;
+
+    // Aggregates over the trailing window of n days ending at each day. The
+    // result starts at start() + n - 1, the first day with a full window.
+    [[nodiscard]] date_series rolling_sum( size_type n ) const;
+    [[nodiscard]] date_series<double> rolling_mean( size_type n ) const;
+    [[nodiscard]] date_series rolling_min( size_type n ) const;
+    [[nodiscard]] date_series rolling_max( size_type n ) const;
+
+    // Calls reduce( std::span<const T> ) once per calendar week (Monday to
+    // Sunday), month or year the series overlaps. Each result is paired
+    // with the calendar start of its bucket.
+    template< typename F >
+    [[nodiscard]] auto resample( period , F reduce ) const;
+
+private:
+
+    [[nodiscard]] std::size_t slot( const date& ) const;
+    [[nodiscard]] rep next_bucket( rep serial , period ) const;
+
+    template< typename Compare >
+    [[nodiscard]] date_series rolling_extreme( size_type n , Compare ) const;
+
+    rep            m_start {};
+    std::vector<T> m_values;
+};
+
+template< typename T >
+date_series<T>::date_series( const date& start , size_type n , const T& value )
+    :   m_start  { start.serial() }
+    ,   m_values ( n , value )
+{}
+
+template< typename T >
+date_series<T>::date_series( const date& start , std::vector<T> values )
+    :   m_start  { start.serial() }
+    ,   m_values ( std::move( values ) )
+{}
+
+template< typename T >
+date date_series<T>::start() const
+{
+    return date::from_serial( m_start );
+}
+
+template< typename T >
+date date_series<T>::last() const
+{
+    assert( !empty() );
+
+    return date::from_serial( m_start + rep( m_values.size() ) - 1 );
+}
+
+template< typename T >
+typename date_series<T>::size_type date_series<T>::size() const
+{
+    return m_values.size();
+}
+
+template< typename T >
+bool date_series<T>::empty() const
+{
+    return m_values.empty();
+}
+
+template< typename T >
+bool date_series<T>::contains( const date& d ) const
+{
+    return slot( d ) < m_values.size();
+}
+
+template< typename T >
+date date_series<T>::date_at( size_type i ) const
+{
+    return date::from_serial( m_start + rep( i ) );
+}
+
+template< typename T >
+std::span<T> date_series<T>::values()
+{
+    return m_values;
+}
+
+template< typename T >
+std::span<const T> date_series<T>::values() const
+{
+    return m_values;
+}
+
+template< typename T >
+T& date_series<T>::operator[]( const date& d )
+{
+    assert( contains( d ) );
+
+    return m_values[ slot( d ) ];
+}
+
+template< typename T >
+const T& date_series<T>::operator[]( const date& d ) const
+{
+    assert( contains( d ) );
+
+    return m_values[ slot( d ) ];
+}
+
+template< typename T >
+T& date_series<T>::at( const date& d )
+{
+    return const_cast<T&>( std::as_const( *this ).at( d ) );
+}
+
+template< typename T >
+const T& date_series<T>::at( const date& d ) const
+{
+    if ( !contains( d ) )
+        throw std::out_of_range { "date_series::at: date outside the series" };
+
+    return m_values[ slot( d ) ];
+}
+
+template< typename T >
+std::span<T> date_series<T>::slice( const date& first , const date& last )
+{
+    auto s { std::as_const( *this ).slice( first , last ) };
+
+    return { const_cast<T*>( s.data() ) , s.size() };
+}
+
+template< typename T >
+std::span<const T> date_series<T>::slice( const date& first , const date& last ) const
+{
+    rep n { rep( m_values.size() ) };
+    rep i { std::clamp( first.serial() - m_start , 0 , n ) };
+    rep j { std::clamp( last.serial() - m_start , i , n ) };
+
+    return std::span<const T> { m_values }.subspan( std::size_t( i ) , std::size_t( j - i ) );
+}
+
+template< typename T >
+date_series<T> date_series<T>::rolling_sum( size_type n ) const
+{
+    assert( n > 0 );
+
+    if ( n > m_values.size() )
+        return { date::from_serial( m_start ) , 0 };
+
+    std::vector<T> out ( m_values.size() - n + 1 );
+    T              sum {};
+
+    for ( size_type i {} ; i < n ; ++i )
+        sum += m_values[ i ];
+
+    out[ 0 ] = sum;
+
+    for ( size_type i { n } ; i < m_values.size() ; ++i )
+    {
+        sum += m_values[ i ];
+        sum -= m_values[ i - n ];
+        out[ i - n + 1 ] = sum;
+    }
+
+    return { date::from_serial( m_start + rep( n ) - 1 ) , std::move( out ) };
+}
+
+template< typename T >
+date_series<double> date_series<T>::rolling_mean( size_type n ) const
+{
+    date_series         sums { rolling_sum( n ) };
+    std::vector<double> out  ( sums.size() );
+
+    for ( size_type i {} ; i < out.size() ; ++i )
+        out[ i ] = double( sums.m_values[ i ] ) / double( n );
+
+    return { sums.start() , std::move( out ) };
+}
+
+template< typename T >
+date_series<T> date_series<T>::rolling_min( size_type n ) const
+{
+    return rolling_extreme( n , std::less<> {} );
+}
+
+template< typename T >
+date_series<T> date_series<T>::rolling_max( size_type n ) const
+{
+    return rolling_extreme( n , std::greater<> {} );
+}
+
+// Monotonic queue of candidate indices: each value enters and leaves once,
+// so the whole pass is O( size() ) regardless of the window length.
+template< typename T >
+template< typename Compare >
+date_series<T> date_series<T>::rolling_extreme( size_type n , Compare better ) const
+{
+    assert( n > 0 );
+
+    if ( n > m_values.size() )
+        return { date::from_serial( m_start ) , 0 };
+
+    std::vector<T>        out ( m_values.size() - n + 1 );
+    std::deque<size_type> candidates;
+
+    for ( size_type i {} ; i < m_values.size() ; ++i )
+    {
+        while ( !candidates.empty() && !better( m_values[ candidates.back() ] , m_values[ i ] ) )
+            candidates.pop_back();
+
+        candidates.push_back( i );
+
+        if ( candidates.front() + n <= i )
+            candidates.pop_front();
+
+        if ( i + 1 >= n )
+            out[ i + 1 - n ] = m_values[ candidates.front() ];
+    }
+
+    return { date::from_serial( m_start + rep( n ) - 1 ) , std::move( out ) };
+}
+
+template< typename T >
+template< typename F >
+auto date_series<T>::resample( period p , F reduce ) const
+{
+    using result = std::invoke_result_t<F& , std::span<const T>>;
+
+    std::vector<std::pair<date , result>> out;
+
+    rep end { m_start + rep( m_values.size() ) };
+
+    for ( rep first { m_start } ; first < end ; )
+    {
+        rep  next         { std::min( next_bucket( first , p ) , end ) };
+        date bucket_start { date::from_serial( first ) };
+
+        switch ( p )
+        {
+            case period::week  : bucket_start = date::from_serial( first - first % 7 ); break;
+            case period::month : bucket_start.set_month_day( 1 ); break;
+            case period::year  : bucket_start = date { 1 , 1 , bucket_start.year() }; break;
+        }
+
+        out.emplace_back(
+            bucket_start ,
+            reduce( std::span<const T> { m_values }.subspan( std::size_t( first - m_start ) , std::size_t( next - first ) ) )
+        );
+
+        first = next;
+    }
+
+    return out;
+}
+
+template< typename T >
+std::size_t date_series<T>::slot( const date& d ) const
+{
+    return std::size_t( std::make_unsigned_t<rep>( d.serial() - m_start ) );
+}
+
+// Serial day number of the first day of the bucket after the one holding
+// serial. Serial 0 is a Monday, so weeks start at multiples of 7.
+template< typename T >
+typename date_series<T>::rep date_series<T>::next_bucket( rep serial , period p ) const
+{
+    date d { date::from_serial( serial ) };
+
+    switch ( p )
+    {
+        case period::week  : return serial - serial % 7 + 7;
+        case period::month : return d.month() == 12 ? date { 1 , 1 , d.year() + 1 }.serial()
+                                                    : date { 1 , d.month() + 1 , d.year() }.serial();
+        case period::year  : return date { 1 , 1 , d.year() + 1 }.serial();
+    }
+
+    return serial + 1;
+}
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "date_sort.hpp"
+#include <algorithm>
+#include <vector>
+
+static std::vector<project::date> random_dates( std::size_t n , int spread )
+{
+    using namespace project;
+
+    std::vector<date> dates ( n );
+    std::mt19937      gen   { 5 };
+    std::uniform_int_distribution<> dist { 0 , spread };
+
+    for ( auto& d : dates )
+        d = date { 1 , 1 , 1950 } + dist( gen );
+
+    return dates;
+}
+
+TEST_CASE( "void sort_dates( std::span<date> )" )
+{
+    using namespace project;
+
+    for ( std::size_t n : { 0 , 1 , 2 , 63 , 64 , 1000 , 100000 } )
+        for ( int spread : { 0 , 30 , 3000 , 3000000 } )
+        {
+            auto dates    = random_dates( n , spread );
+            auto expected = dates;
+
+            std::sort( expected.begin() , expected.end() );
+            sort_dates( dates );
+
+            REQUIRE( dates == expected );
+        }
+}
+
+TEST_CASE( "void parallel_sort_dates( std::span<date> , unsigned )" )
+{
+    using namespace project;
+
+    for ( unsigned n_threads : { 1 , 2 , 3 , 8 } )
+        for ( int spread : { 30 , 30000 , 3000000 } )
+        {
+            auto dates    = random_dates( 100003 , spread );
+            auto expected = dates;
+
+            std::sort( expected.begin() , expected.end() );
+            parallel_sort_dates( dates , n_threads );
+
+            REQUIRE( dates == expected );
+        }
+}
+
+TEST_CASE( "sort_dates() benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    std::size_t n { GENERATE( std::size_t( 1'000'000 ) , std::size_t( 10'000'000 ) , std::size_t( 100'000'000 ) ) };
+
+    auto input = random_dates( n , 365 * 60 );
+    auto work  = input;
+
+    BENCHMARK_ADVANCED( "std::sort " + std::to_string( n ) )( Catch::Benchmark::Chronometer meter )
+    {
+        work = input;
+        meter.measure( [ & ] { std::sort( work.begin() , work.end() ); } );
+    };
+
+    BENCHMARK_ADVANCED( "sort_dates " + std::to_string( n ) )( Catch::Benchmark::Chronometer meter )
+    {
+        work = input;
+        meter.measure( [ & ] { sort_dates( work ); } );
+    };
+
+    BENCHMARK_ADVANCED( "parallel_sort_dates " + std::to_string( n ) )( Catch::Benchmark::Chronometer meter )
+    {
+        work = input;
+        meter.measure( [ & ] { parallel_sort_dates( work ); } );
+    };
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef DATE_SORT_H
+#define DATE_SORT_H
+
+#include "date.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace project
+{
+
+inline void sort_dates( std::span<date> dates );
+inline void parallel_sort_dates( std::span<date> dates , unsigned n_threads = std::thread::hardware_concurrency() );
+
+namespace detail
+{
+
+inline constexpr std::size_t SORT_CUTOFF = 64;
+inline constexpr int         RADIX_BITS  = 11;
+inline constexpr std::size_t RADIX_SIZE  = std::size_t( 1 ) << RADIX_BITS;
+
+using radix_histogram = std::array<std::size_t , RADIX_SIZE>;
+
+// Runs f( slice , first , last ) over n_threads contiguous slices of [ 0 , n ).
+template< typename F >
+inline void parallel_for( unsigned n_threads , std::size_t n , F f )
+{
+    std::vector<std::thread> workers;
+
+    workers.reserve( n_threads - 1 );
+
+    for ( unsigned t { 1 } ; t < n_threads ; ++t )
+        workers.emplace_back( f , t , n * t / n_threads , n * ( t + 1 ) / n_threads );
+
+    f( 0u , std::size_t( 0 ) , n / n_threads );
+
+    for ( auto& worker : workers )
+        worker.join();
+}
+
+// Sorts dates by their packed_date bits. Keys are offset by the minimum so
+// that only the bits that actually differ need radix passes; ranges no wider
+// than the input are counting-sorted instead.
+inline void sort_packed( std::span<date> dates , unsigned n_threads )
+{
+    std::size_t n { dates.size() };
+
+    std::vector<std::uint32_t> keys ( n );
+    std::vector<std::uint32_t> min_of ( n_threads , UINT32_MAX );
+    std::vector<std::uint32_t> max_of ( n_threads , 0 );
+
+    parallel_for( n_threads , n , [ & ] ( unsigned slice , std::size_t first , std::size_t last ) {
+        std::uint32_t lo { UINT32_MAX };
+        std::uint32_t hi { 0 };
+
+        for ( std::size_t i { first } ; i < last ; ++i )
+        {
+            keys[ i ] = packed_date { dates[ i ] }.bits();
+            lo        = std::min( lo , keys[ i ] );
+            hi        = std::max( hi , keys[ i ] );
+        }
+
+        min_of[ slice ] = lo;
+        max_of[ slice ] = hi;
+    } );
+
+    std::uint32_t min   { *std::min_element( min_of.begin() , min_of.end() ) };
+    std::uint32_t range { *std::max_element( max_of.begin() , max_of.end() ) - min };
+
+    if ( range < n )
+    {
+        std::vector<std::uint32_t> counts ( std::size_t( range ) + 1 );
+
+        for ( auto key : keys )
+            ++counts[ key - min ];
+
+        std::size_t i {};
+
+        for ( std::uint32_t key {} ; key <= range ; ++key )
+        {
+            if ( !counts[ key ] )
+                continue;
+
+            std::fill_n( dates.begin() + i , counts[ key ] , packed_date::from_bits( key + min ).to_date() );
+
+            i += counts[ key ];
+        }
+
+        return;
+    }
+
+    std::vector<std::uint32_t>   buffer ( n );
+    std::vector<radix_histogram> histograms ( n_threads );
+
+    int passes { ( int( std::bit_width( range ) ) + RADIX_BITS - 1 ) / RADIX_BITS };
+
+    for ( int pass {} ; pass < passes ; ++pass )
+    {
+        int shift { pass * RADIX_BITS };
+
+        auto digit = [ & ] ( std::uint32_t key ) {
+            return ( key - min ) >> shift & ( RADIX_SIZE - 1 );
+        };
+
+        parallel_for( n_threads , n , [ & ] ( unsigned slice , std::size_t first , std::size_t last ) {
+            auto& histogram = histograms[ slice ];
+
+            histogram.fill( 0 );
+
+            for ( std::size_t i { first } ; i < last ; ++i )
+                ++histogram[ digit( keys[ i ] ) ];
+        } );
+
+        // Turn per-thread counts into per-thread starting offsets so every
+        // slice scatters stably into its own part of each bucket.
+        std::size_t offset {};
+
+        for ( std::size_t bucket {} ; bucket < RADIX_SIZE ; ++bucket )
+            for ( auto& histogram : histograms )
+                offset += std::exchange( histogram[ bucket ] , offset );
+
+        parallel_for( n_threads , n , [ & ] ( unsigned slice , std::size_t first , std::size_t last ) {
+            auto& histogram = histograms[ slice ];
+
+            for ( std::size_t i { first } ; i < last ; ++i )
+                buffer[ histogram[ digit( keys[ i ] ) ]++ ] = keys[ i ];
+        } );
+
+        keys.swap( buffer );
+    }
+
+    parallel_for( n_threads , n , [ & ] ( unsigned , std::size_t first , std::size_t last ) {
+        for ( std::size_t i { first } ; i < last ; ++i )
+            dates[ i ] = packed_date::from_bits( keys[ i ] ).to_date();
+    } );
+}
+
+}
+
+void sort_dates( std::span<date> dates )
+{
+    if ( dates.size() < detail::SORT_CUTOFF )
+        std::sort( dates.begin() , dates.end() );
+    else
+        detail::sort_packed( dates , 1 );
+}
+
+void parallel_sort_dates( std::span<date> dates , unsigned n_threads )
+{
+    n_threads = std::max( n_threads , 1u );
+
+    if ( dates.size() < detail::SORT_CUTOFF * n_threads )
+        sort_dates( dates );
+    else
+        detail::sort_packed( dates , n_threads );
+}
+
+}
+
+#endif
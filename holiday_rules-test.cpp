@@ -0,0 +1,188 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+#include "holiday_rules.hpp"
+#include <vector>
+
+TEST_CASE( "date easter_sunday( int )" )
+{
+    using namespace project;
+
+    STATIC_REQUIRE( easter_sunday( 2024 ) == date { 31 , 3 , 2024 } );
+    STATIC_REQUIRE( easter_sunday( 2000 ) == date { 23 , 4 , 2000 } );
+    STATIC_REQUIRE( easter_sunday( 1943 ) == date { 25 , 4 , 1943 } );
+    STATIC_REQUIRE( easter_sunday( 2285 ) == date { 22 , 3 , 2285 } );
+
+    bool correct { true };
+
+    for ( int year { 1900 } ; year < 2500 ; ++year )
+    {
+        date e { easter_sunday( year ) };
+
+        correct &= e.week_day() == date::day::sunday;
+        correct &= e >= date { 22 , 3 , year } && e <= date { 25 , 4 , year };
+    }
+
+    REQUIRE( correct );
+}
+
+TEST_CASE( "std::optional<date> holiday_rule::in_year( int )" )
+{
+    using namespace project;
+
+    using shift = holiday_rule::shift;
+
+    STATIC_REQUIRE( holiday_rule::fixed( 4 , 7 ).in_year( 2024 ) == date { 4 , 7 , 2024 } );
+    STATIC_REQUIRE( holiday_rule::nth_weekday( 4 , date::day::thursday , 11 ).in_year( 2024 ) == date { 28 , 11 , 2024 } );
+    STATIC_REQUIRE( holiday_rule::nth_weekday( 1 , date::day::monday , 9 ).in_year( 2024 ) == date { 2 , 9 , 2024 } );
+    STATIC_REQUIRE( holiday_rule::last_weekday( date::day::monday , 5 ).in_year( 2024 ) == date { 27 , 5 , 2024 } );
+    STATIC_REQUIRE( holiday_rule::last_weekday( date::day::tuesday , 12 ).in_year( 2024 ) == date { 31 , 12 , 2024 } );
+    STATIC_REQUIRE( holiday_rule::easter( -2 ).in_year( 2024 ) == date { 29 , 3 , 2024 } );
+
+    REQUIRE( holiday_rule::nth_weekday( 5 , date::day::friday , 2 ).in_year( 2024 ) == std::nullopt );
+    REQUIRE( holiday_rule::nth_weekday( 5 , date::day::thursday , 2 ).in_year( 2024 ) == date { 29 , 2 , 2024 } );
+    REQUIRE( holiday_rule::fixed( 19 , 6 ).since( 2021 ).in_year( 2020 ) == std::nullopt );
+    REQUIRE( holiday_rule::fixed( 11 , 11 ).until( 1977 ).in_year( 1977 ) == date { 11 , 11 , 1977 } );
+    REQUIRE( holiday_rule::fixed( 11 , 11 ).until( 1977 ).in_year( 1978 ) == std::nullopt );
+
+    // 25/12/2021 was a Saturday and 25/12/2022 a Sunday.
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).in_year( 2021 ) == date { 25 , 12 , 2021 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::nearest_weekday ).in_year( 2021 ) == date { 24 , 12 , 2021 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::nearest_weekday ).in_year( 2022 ) == date { 26 , 12 , 2022 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::next_monday ).in_year( 2021 ) == date { 27 , 12 , 2021 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::next_monday ).in_year( 2023 ) == date { 25 , 12 , 2023 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::sunday_to_monday ).in_year( 2021 ) == date { 25 , 12 , 2021 } );
+    REQUIRE( holiday_rule::fixed( 25 , 12 ).observed( shift::sunday_to_monday ).in_year( 2022 ) == date { 26 , 12 , 2022 } );
+}
+
+TEST_CASE( "holiday_bitmap<FIRST_YEAR , LAST_YEAR>::from_rules( std::span<const holiday_rule> )" )
+{
+    using namespace project;
+
+    static constexpr auto us = holiday_bitmap<2000 , 2030>::from_rules( US_FEDERAL_HOLIDAYS );
+
+    STATIC_REQUIRE( us.is_holiday( date { 1 , 1 , 2024 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 15 , 1 , 2024 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 28 , 11 , 2024 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 29 , 11 , 2024 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 19 , 6 , 2020 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 20 , 6 , 2022 } ) );
+
+    // 01/01/2022 was a Saturday, observed on Friday 31/12/2021.
+    STATIC_REQUIRE( us.is_holiday( date { 31 , 12 , 2021 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 1 , 1 , 1990 } ) );
+
+    std::vector<date> expected_2024 {
+        { 1  , 1  , 2024 } , { 15 , 1  , 2024 } , { 19 , 2  , 2024 } , { 27 , 5  , 2024 } ,
+        { 19 , 6  , 2024 } , { 4  , 7  , 2024 } , { 2  , 9  , 2024 } , { 14 , 10 , 2024 } ,
+        { 11 , 11 , 2024 } , { 28 , 11 , 2024 } , { 25 , 12 , 2024 }
+    };
+    std::vector<date> found;
+
+    for ( date d { 1 , 1 , 2024 } ; d < date { 1 , 1 , 2025 } ; ++d )
+        if ( us.is_holiday( d ) )
+            found.push_back( d );
+
+    REQUIRE( found == expected_2024 );
+}
+
+TEST_CASE( "holiday_bitmap<FIRST_YEAR , LAST_YEAR>::from_rules( std::span<const holiday_rule> ) before 1978" )
+{
+    using namespace project;
+
+    static constexpr auto us = holiday_bitmap<1950 , 1980>::from_rules( US_FEDERAL_HOLIDAYS );
+
+    // Veterans Day was the fourth Monday of October from 1971 to 1977.
+    STATIC_REQUIRE( us.is_holiday( date { 27 , 10 , 1975 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 11 , 11 , 1975 } ) );
+
+    // 11/11/1978 was a Saturday, observed on Friday 10/11/1978.
+    STATIC_REQUIRE( us.is_holiday( date { 10 , 11 , 1978 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 23 , 10 , 1978 } ) );
+
+    std::vector<date> expected_1975 {
+        { 1  , 1  , 1975 } , { 17 , 2  , 1975 } , { 26 , 5  , 1975 } , { 4  , 7  , 1975 } ,
+        { 1  , 9  , 1975 } , { 13 , 10 , 1975 } , { 27 , 10 , 1975 } , { 27 , 11 , 1975 } ,
+        { 25 , 12 , 1975 }
+    };
+    std::vector<date> found;
+
+    for ( date d { 1 , 1 , 1975 } ; d < date { 1 , 1 , 1976 } ; ++d )
+        if ( us.is_holiday( d ) )
+            found.push_back( d );
+
+    REQUIRE( found == expected_1975 );
+
+    // Before 1971 holidays fell on fixed dates and only a Sunday moved to
+    // Monday: 01/01/1950 was a Sunday and 11/11/1950 a Saturday.
+    std::vector<date> expected_1950 {
+        { 2  , 1  , 1950 } , { 22 , 2  , 1950 } , { 30 , 5  , 1950 } , { 4  , 7  , 1950 } ,
+        { 4  , 9  , 1950 } , { 12 , 10 , 1950 } , { 11 , 11 , 1950 } , { 23 , 11 , 1950 } ,
+        { 25 , 12 , 1950 }
+    };
+
+    found.clear();
+
+    for ( date d { 1 , 1 , 1950 } ; d < date { 1 , 1 , 1951 } ; ++d )
+        if ( us.is_holiday( d ) )
+            found.push_back( d );
+
+    REQUIRE( found == expected_1950 );
+    REQUIRE( !us.is_holiday( date { 25 , 5 , 1970 } ) );
+    REQUIRE( us.is_holiday( date { 30 , 5 , 1970 } ) );
+}
+
+TEST_CASE( "holiday_bitmap<FIRST_YEAR , LAST_YEAR>::from_rules( std::span<const holiday_rule> ) before 1942" )
+{
+    using namespace project;
+
+    static constexpr auto us = holiday_bitmap<1930 , 1945>::from_rules( US_FEDERAL_HOLIDAYS );
+
+    STATIC_REQUIRE( !us.is_holiday( date { 12 , 10 , 1936 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 12 , 10 , 1937 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 11 , 11 , 1937 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 11 , 11 , 1938 } ) );
+
+    // Thanksgiving was the last Thursday of November until 1938, was set by
+    // proclamation from 1939 to 1941 and is the fourth Thursday since 1942.
+    STATIC_REQUIRE( us.is_holiday( date { 24 , 11 , 1938 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 21 , 11 , 1940 } ) );
+    STATIC_REQUIRE( !us.is_holiday( date { 28 , 11 , 1940 } ) );
+    STATIC_REQUIRE( us.is_holiday( date { 26 , 11 , 1942 } ) );
+}
+
+TEST_CASE( "business_calendar holiday_bitmap<FIRST_YEAR , LAST_YEAR>::calendar( std::uint8_t ) const" )
+{
+    using namespace project;
+
+    static constexpr auto target = holiday_bitmap<2020 , 2030>::from_rules( TARGET_HOLIDAYS );
+
+    business_calendar cal { target.calendar() };
+
+    REQUIRE( cal.first() == date { 1 , 1 , 2020 } );
+    REQUIRE( cal.last() == date { 1 , 1 , 2031 } );
+    REQUIRE( !cal.is_business_day( date { 29 , 3 , 2024 } ) );
+    REQUIRE( !cal.is_business_day( date { 1 , 4 , 2024 } ) );
+    REQUIRE( cal.add_business_days( date { 28 , 3 , 2024 } , 1 ) == date { 2 , 4 , 2024 } );
+    REQUIRE( cal.add_business_days( date { 24 , 12 , 2024 } , 1 ) == date { 27 , 12 , 2024 } );
+
+    // 2024 has 262 weekdays; all six TARGET2 holidays fall on one of them.
+    REQUIRE( cal.business_days_between( date { 1 , 1 , 2024 } , date { 1 , 1 , 2025 } ) == 256 );
+}
+
+TEST_CASE( "holiday_bitmap benchmark" , "[!benchmark]" )
+{
+    using namespace project;
+
+    static constexpr auto baked = holiday_bitmap<1950 , 2100>::from_rules( US_FEDERAL_HOLIDAYS );
+
+    BENCHMARK( "US federal 1950-2100, holiday_bitmap::from_rules() at run time" )
+    {
+        return holiday_bitmap<1950 , 2100>::from_rules( US_FEDERAL_HOLIDAYS ).words()[ 0 ];
+    };
+
+    BENCHMARK( "US federal 1950-2100, calendar from constexpr bitmap" )
+    {
+        return baked.calendar().business_days_between( baked.first() , baked.last() );
+    };
+}
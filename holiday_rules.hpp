@@ -0,0 +1,321 @@
+#pragma once
+
+#ifndef HOLIDAY_RULES_H
+#define HOLIDAY_RULES_H
+
+#include "business_calendar.hpp"
+#include "date.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace project
+{
+
+// Gregorian Easter Sunday (anonymous Gregorian algorithm, Meeus/Jones/Butcher).
+[[nodiscard]] constexpr date easter_sunday( int year )
+{
+    int a { year % 19 };
+    int b { year / 100 };
+    int c { year % 100 };
+    int d { b / 4 };
+    int e { b % 4 };
+    int f { ( b + 8 ) / 25 };
+    int g { ( b - f + 1 ) / 3 };
+    int h { ( 19 * a + b - d - g + 15 ) % 30 };
+    int i { c / 4 };
+    int k { c % 4 };
+    int l { ( 32 + 2 * e + 2 * i - h - k ) % 7 };
+    int m { ( a + 11 * h + 22 * l ) / 451 };
+    int n { h + l - 7 * m + 114 };
+
+    return date { n % 31 + 1 , n / 31 , year };
+}
+
+// One way of placing a holiday in a year. Rules are built with the static
+// factories and refined with observed(), since() and until(); everything is
+// constexpr so rule sets can be expanded at compile time.
+class holiday_rule
+{
+
+public:
+
+    // Where a holiday that falls on a weekend is observed instead.
+    enum class shift
+    {
+        none             ,
+        nearest_weekday  ,  // Saturday to Friday, Sunday to Monday
+        next_monday      ,  // Saturday and Sunday to Monday
+        sunday_to_monday    // Sunday to Monday, Saturday stays
+    };
+
+    [[nodiscard]] static constexpr holiday_rule fixed( int day , int month );
+    [[nodiscard]] static constexpr holiday_rule nth_weekday( int n , date::day , int month );
+    [[nodiscard]] static constexpr holiday_rule last_weekday( date::day , int month );
+    [[nodiscard]] static constexpr holiday_rule easter( int offset );
+
+    [[nodiscard]] constexpr holiday_rule observed( shift ) const;
+    [[nodiscard]] constexpr holiday_rule since( int year ) const;
+    [[nodiscard]] constexpr holiday_rule until( int year ) const;
+
+    // The day the holiday is observed in year, if the rule applies that year.
+    [[nodiscard]] constexpr std::optional<date> in_year( int year ) const;
+
+private:
+
+    enum class kind
+    {
+        fixed        ,
+        nth_weekday  ,
+        last_weekday ,
+        easter
+    };
+
+    constexpr holiday_rule( kind type , int day , int month , date::day week_day , int n );
+
+    kind      m_kind;
+    int       m_day;
+    int       m_month;
+    date::day m_week_day;
+    int       m_n;
+    shift     m_shift { shift::none };
+    int       m_since { date::BASE_YEAR };
+    int       m_until { date::MAX_YEAR };
+};
+
+constexpr holiday_rule::holiday_rule( kind type , int day , int month , date::day week_day , int n )
+    :   m_kind     { type }
+    ,   m_day      { day }
+    ,   m_month    { month }
+    ,   m_week_day { week_day }
+    ,   m_n        { n }
+{}
+
+constexpr holiday_rule holiday_rule::fixed( int day , int month )
+{
+    return { kind::fixed , day , month , date::day::sunday , 0 };
+}
+
+// The n-th given week day of month, e.g. nth_weekday( 3 , monday , 1 ).
+constexpr holiday_rule holiday_rule::nth_weekday( int n , date::day week_day , int month )
+{
+    assert( n >= 1 && n <= 5 );
+
+    return { kind::nth_weekday , 1 , month , week_day , n };
+}
+
+constexpr holiday_rule holiday_rule::last_weekday( date::day week_day , int month )
+{
+    return { kind::last_weekday , 1 , month , week_day , 0 };
+}
+
+// offset days from Easter Sunday, e.g. -2 for Good Friday.
+constexpr holiday_rule holiday_rule::easter( int offset )
+{
+    return { kind::easter , 0 , 0 , date::day::sunday , offset };
+}
+
+constexpr holiday_rule holiday_rule::observed( shift s ) const
+{
+    holiday_rule rule { *this };
+
+    rule.m_shift = s;
+
+    return rule;
+}
+
+constexpr holiday_rule holiday_rule::since( int year ) const
+{
+    holiday_rule rule { *this };
+
+    rule.m_since = year;
+
+    return rule;
+}
+
+// The last year the rule applies, inclusive.
+constexpr holiday_rule holiday_rule::until( int year ) const
+{
+    holiday_rule rule { *this };
+
+    rule.m_until = year;
+
+    return rule;
+}
+
+constexpr std::optional<date> holiday_rule::in_year( int year ) const
+{
+    if ( year < m_since || year > m_until )
+        return std::nullopt;
+
+    date d;
+
+    switch ( m_kind )
+    {
+        case kind::fixed :
+            d = date { m_day , m_month , year };
+            break;
+
+        case kind::nth_weekday :
+        {
+            date first { 1 , m_month , year };
+
+            d = first + ( int( m_week_day ) - int( first.week_day() ) + 7 ) % 7 + 7 * ( m_n - 1 );
+
+            if ( d.month() != m_month )
+                return std::nullopt;
+
+            break;
+        }
+
+        case kind::last_weekday :
+        {
+            date last { m_month == 12 ? date { 31 , 12 , year } : date { 1 , m_month + 1 , year } - 1 };
+
+            d = last - ( int( last.week_day() ) - int( m_week_day ) + 7 ) % 7;
+            break;
+        }
+
+        case kind::easter :
+            d = easter_sunday( year ) + m_n;
+            break;
+    }
+
+    date::day wd { d.week_day() };
+
+    if ( wd == date::day::saturday )
+    {
+        if ( m_shift == shift::nearest_weekday )
+            --d;
+        else if ( m_shift == shift::next_monday )
+            d += 2;
+    }
+    else if ( wd == date::day::sunday && m_shift != shift::none )
+        ++d;
+
+    return d;
+}
+
+// Holidays for the years [ FIRST_YEAR , LAST_YEAR ] as one bit per day,
+// bit i standing for 01/01/FIRST_YEAR + i. Small enough to be a constexpr
+// variable, so a rule set expanded at compile time lands in read-only data.
+template< int FIRST_YEAR , int LAST_YEAR >
+class holiday_bitmap
+{
+
+public:
+
+    static_assert( FIRST_YEAR >= date::BASE_YEAR && FIRST_YEAR <= LAST_YEAR );
+
+    static constexpr serial_date::rep FIRST_SERIAL = date { 1 , 1 , FIRST_YEAR }.serial();
+    static constexpr serial_date::rep LAST_SERIAL  = date { 1 , 1 , LAST_YEAR + 1 }.serial();
+    static constexpr std::size_t      WORDS        = std::size_t( LAST_SERIAL - FIRST_SERIAL ) / 64 + 1;
+
+    [[nodiscard]] static constexpr holiday_bitmap from_rules( std::span<const holiday_rule> rules );
+
+    [[nodiscard]] constexpr date first() const { return date::from_serial( FIRST_SERIAL ); }
+    [[nodiscard]] constexpr date last() const { return date::from_serial( LAST_SERIAL ); }
+    [[nodiscard]] constexpr std::span<const std::uint64_t> words() const { return m_words; }
+    [[nodiscard]] constexpr bool is_holiday( const date& ) const;
+
+    [[nodiscard]] business_calendar calendar( std::uint8_t weekend = business_calendar::SATURDAY_SUNDAY ) const;
+
+private:
+
+    std::array<std::uint64_t , WORDS> m_words {};
+};
+
+// A shifted holiday can land in the neighbouring year, so the years on
+// either side of the range are expanded too and clipped to it.
+template< int FIRST_YEAR , int LAST_YEAR >
+constexpr holiday_bitmap<FIRST_YEAR , LAST_YEAR> holiday_bitmap<FIRST_YEAR , LAST_YEAR>::from_rules( std::span<const holiday_rule> rules )
+{
+    holiday_bitmap bitmap;
+
+    for ( int year { std::max( FIRST_YEAR - 1 , date::BASE_YEAR ) } ; year <= LAST_YEAR + 1 ; ++year )
+        for ( const auto& rule : rules )
+            if ( auto d = rule.in_year( year ) )
+            {
+                serial_date::rep serial { d->serial() };
+
+                if ( serial >= FIRST_SERIAL && serial < LAST_SERIAL )
+                {
+                    std::size_t i { std::size_t( serial - FIRST_SERIAL ) };
+
+                    bitmap.m_words[ i / 64 ] |= std::uint64_t( 1 ) << ( i % 64 );
+                }
+            }
+
+    return bitmap;
+}
+
+template< int FIRST_YEAR , int LAST_YEAR >
+constexpr bool holiday_bitmap<FIRST_YEAR , LAST_YEAR>::is_holiday( const date& d ) const
+{
+    serial_date::rep serial { d.serial() };
+
+    if ( serial < FIRST_SERIAL || serial >= LAST_SERIAL )
+        return false;
+
+    std::size_t i { std::size_t( serial - FIRST_SERIAL ) };
+
+    return m_words[ i / 64 ] >> ( i % 64 ) & 1;
+}
+
+template< int FIRST_YEAR , int LAST_YEAR >
+business_calendar holiday_bitmap<FIRST_YEAR , LAST_YEAR>::calendar( std::uint8_t weekend ) const
+{
+    return business_calendar::from_holiday_bits( first() , last() , m_words , weekend );
+}
+
+// United States federal holidays (5 U.S.C. 6103). The Monday holidays took
+// their current form in 1971; before that Washington's Birthday, Memorial Day,
+// Columbus Day and Armistice Day fell on fixed dates, Thanksgiving moved to
+// the fourth Thursday in 1942, and only a Sunday holiday was observed on the
+// next day. Veterans Day was the fourth Monday of October from 1971 to 1977.
+// Since 1971 weekend holidays are observed on the nearest weekday.
+inline constexpr std::array US_FEDERAL_HOLIDAYS {
+    holiday_rule::fixed( 1 , 1 ).observed( holiday_rule::shift::sunday_to_monday ).until( 1970 ) ,
+    holiday_rule::fixed( 1 , 1 ).observed( holiday_rule::shift::nearest_weekday ).since( 1971 ) ,
+    holiday_rule::nth_weekday( 3 , date::day::monday , 1 ).since( 1986 ) ,
+    holiday_rule::fixed( 22 , 2 ).observed( holiday_rule::shift::sunday_to_monday ).until( 1970 ) ,
+    holiday_rule::nth_weekday( 3 , date::day::monday , 2 ).since( 1971 ) ,
+    holiday_rule::fixed( 30 , 5 ).observed( holiday_rule::shift::sunday_to_monday ).until( 1970 ) ,
+    holiday_rule::last_weekday( date::day::monday , 5 ).since( 1971 ) ,
+    holiday_rule::fixed( 19 , 6 ).observed( holiday_rule::shift::nearest_weekday ).since( 2021 ) ,
+    holiday_rule::fixed( 4 , 7 ).observed( holiday_rule::shift::sunday_to_monday ).until( 1970 ) ,
+    holiday_rule::fixed( 4 , 7 ).observed( holiday_rule::shift::nearest_weekday ).since( 1971 ) ,
+    holiday_rule::nth_weekday( 1 , date::day::monday , 9 ) ,
+    holiday_rule::fixed( 12 , 10 ).observed( holiday_rule::shift::sunday_to_monday ).since( 1937 ).until( 1970 ) ,
+    holiday_rule::nth_weekday( 2 , date::day::monday , 10 ).since( 1971 ) ,
+    holiday_rule::fixed( 11 , 11 ).observed( holiday_rule::shift::sunday_to_monday ).since( 1938 ).until( 1970 ) ,
+    holiday_rule::nth_weekday( 4 , date::day::monday , 10 ).since( 1971 ).until( 1977 ) ,
+    holiday_rule::fixed( 11 , 11 ).observed( holiday_rule::shift::nearest_weekday ).since( 1978 ) ,
+    holiday_rule::last_weekday( date::day::thursday , 11 ).until( 1938 ) ,
+    holiday_rule::fixed( 23 , 11 ).since( 1939 ).until( 1939 ) ,
+    holiday_rule::fixed( 21 , 11 ).since( 1940 ).until( 1940 ) ,
+    holiday_rule::fixed( 20 , 11 ).since( 1941 ).until( 1941 ) ,
+    holiday_rule::nth_weekday( 4 , date::day::thursday , 11 ).since( 1942 ) ,
+    holiday_rule::fixed( 25 , 12 ).observed( holiday_rule::shift::sunday_to_monday ).until( 1970 ) ,
+    holiday_rule::fixed( 25 , 12 ).observed( holiday_rule::shift::nearest_weekday ).since( 1971 )
+};
+
+// TARGET2 closing days: New Year, Good Friday, Easter Monday, Labour Day,
+// Christmas and St. Stephen's Day.
+inline constexpr std::array TARGET_HOLIDAYS {
+    holiday_rule::fixed( 1 , 1 ) ,
+    holiday_rule::easter( -2 ) ,
+    holiday_rule::easter( 1 ) ,
+    holiday_rule::fixed( 1 , 5 ) ,
+    holiday_rule::fixed( 25 , 12 ) ,
+    holiday_rule::fixed( 26 , 12 )
+};
+
+}
+
+#endif